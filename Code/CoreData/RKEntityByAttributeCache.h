@@ -25,6 +25,8 @@
 
  `RKEntityByAttributeCache` instances are used by the `RKEntityCache` to provide caching for multiple entities at once.
 
+ The cache is safe to use from multiple threads. Its key space is partitioned into shards, each guarded by its own read-write lock, so that lookups never wait for one another and a change to the cache only excludes the lookups of keys within the shards it changes.
+
  @bug Please note that the `RKEntityByAttribute` cache is implemented using a `NSFetchRequest` with a result type of `NSDictionaryResultType`. This means that the cache **cannot** load pending object instances via a fetch from the `load` method. Pending objects must be manually added to the cache via `addObject:` if it is desirable for the pending objects to be retrieved by subsequent invocations of `objectWithAttributeValue:inContext:` and `objectsWithAttributeValue:inContext:` prior to a save.
 
  This is a limitation imposed by Core Data. The dictionary result type implementation is leveraged instead a normal fetch request because it offers very large performance and memory utilization improvements by avoiding construction of managed object instances and faulting.
@@ -82,6 +84,8 @@
  Loads the cache by finding all instances of the configured entity and building
  an association between the value of the cached attribute's value and the
  managed object ID for the object.
+
+ The instances are fetched with a batched fetch request and merged into the cache one batch at a time, so the cache remains available to readers and the managed object context remains available to other work while a large entity is loaded. Objects added to the cache while it is loading are retained.
  
  @param completion A block to execute when the cache has finished loading.
  */
@@ -94,12 +98,53 @@
  */
 - (void)flush:(void (^)(void))completion;
 
+///------------------------------------------------
+/// @name Persisting the Cache in an Identity Index
+///------------------------------------------------
+
+/**
+ Loads the receiver from an identity index file previously written with the data returned by `identityIndexDataWithMetadata:`, rather than fetching the associations from the persistent store.
+
+ The file is memory mapped and its associations are read into the receiver lazily, as each attribute value is first looked up or changed. The index is only used if its metadata is equal to the given metadata, which should identify the state of the persistent store the index was written for. Object ID's read from the index are not counted by `count` or found by `containsObject:` until they have been faulted in.
+
+ @param path The path of the identity index file.
+ @param metadata The metadata the index must have been written with.
+ @return `YES` if the receiver was loaded from the index, or `NO` if the file does not exist, is not valid or is out of date, in which case the receiver should be loaded with `load:`.
+ */
+- (BOOL)loadFromIdentityIndexAtPath:(NSString *)path metadata:(NSDictionary *)metadata;
+
+/**
+ Returns the contents of an identity index file for the associations of the receiver.
+
+ Object ID's that are temporary are omitted, so the index should be written when the managed object context of the cached objects has no unsaved changes. The index is marked incomplete if the receiver is not conclusive because it has evicted attribute values or was loaded partially.
+
+ @param metadata A property list dictionary that identifies the state of the persistent store, which is compared to the metadata given to `loadFromIdentityIndexAtPath:metadata:` when the index is loaded.
+ @return The contents of an identity index file.
+ @see `RKEntityIdentityIndex`
+ */
+- (NSData *)identityIndexDataWithMetadata:(NSDictionary *)metadata;
+
+///----------------------------
+/// @name Bounding Cache Memory
+///----------------------------
+
+/**
+ The maximum number of managed object ID's the receiver retains, or zero if the receiver is unbounded.
+
+ When the number of cached object ID's exceeds the limit, the receiver evicts the object ID's associated with entire attribute values using the CLOCK approximation of least recently used replacement: every attribute value has a reference bit that is set when it is looked up, and a clock hand sweeps the attribute values of each shard of the receiver in insertion order, clearing set bits and evicting the attribute values whose bit is clear. The shards are swept in turn until the receiver is within the limit. Attribute values associated with a temporary object ID are never evicted, as pending objects cannot be reloaded from the persistent store.
+
+ Once an attribute value has been evicted or the limit prevented the receiver from loading every instance of the entity, a lookup that misses the cache is no longer conclusive. Such misses are satisfied by a targeted fetch for the missing attribute values in the context of the lookup and the results are added to the cache.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger maximumObjectIDCount;
+
 ///-----------------------------
 /// @name Inspecting Cache State
 ///-----------------------------
 
 /**
- A Boolean value indicating if the cache has loaded associations between cache attribute values and managed object ID's.
+ A Boolean value indicating if the cache has finished loading associations between cache attribute values and managed object ID's. Objects added to a cache that has not been loaded do not cause it to be considered loaded.
  */
 - (BOOL)isLoaded;
 
@@ -150,6 +195,14 @@
  */
 - (NSManagedObject *)objectWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context;
 
+/**
+ Returns the managed object ID's cached for the given attribute values, without consulting the persistent store or materializing any objects. Attribute values that have been evicted from a bounded cache are not reloaded.
+
+ @param attributeValues A dictionary of values for the cache key attributes. Collection values match any of their members.
+ @return The set of managed object ID's associated with the attribute values, or an empty set.
+ */
+- (NSSet *)objectIDsWithAttributeValues:(NSDictionary *)attributeValues;
+
 /**
  Returns the collection of objects with a matching value for the cache key attribute in a given managed object context.
 
@@ -159,6 +212,30 @@
  */
 - (NSSet *)objectsWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context;
 
+///----------------------------------
+/// @name Inspecting Cache Statistics
+///----------------------------------
+
+/**
+ The number of attribute values looked up by the receiver that were found in the cache.
+ */
+@property (nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of attribute values looked up by the receiver that were not found in the cache.
+ */
+@property (nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The number of attribute values evicted from the receiver to remain within `maximumObjectIDCount`.
+ */
+@property (nonatomic, readonly) NSUInteger evictionCount;
+
+/**
+ Resets the hit, miss and eviction counts of the receiver to zero.
+ */
+- (void)resetStatistics;
+
 ///------------------------------
 /// @name Managing Cached Objects
 ///------------------------------
@@ -183,6 +260,18 @@
  */
 - (void)removeObjects:(NSSet *)managedObjects completion:(void (^)(void))completion;
 
+/**
+ Moves updated managed objects between attribute values in the cache.
+
+ Only objects for which one or more of the cache key attributes has changed are considered: their object ID's are removed from the previous attribute values and associated with the current ones. All other objects are skipped without reading any of their attribute values. This method must be invoked before the end of the event in which the objects were changed, such as when an `NSManagedObjectContextObjectsDidChangeNotification` is observed, so that the previous attribute values can be determined.
+
+ The objects must be instances of the cached entity.
+
+ @param managedObjects The updated managed objects.
+ @param completion An optional block to execute once the cache has been updated.
+ */
+- (void)updateObjects:(NSSet *)managedObjects completion:(void (^)(void))completion;
+
 @end
 
 /*
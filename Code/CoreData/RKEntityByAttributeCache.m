@@ -18,11 +18,15 @@
 //  limitations under the License.
 //
 
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
 #if TARGET_OS_IPHONE
 #import <UIKit/UIKit.h>
 #endif
 
 #import "RKEntityByAttributeCache.h"
+#import "RKEntityIdentityIndex.h"
 #import "RKLog.h"
 #import "RKPropertyInspector.h"
 #import "RKPropertyInspector+CoreData.h"
@@ -33,61 +37,378 @@
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitCoreDataCache
 
-static id RKCacheKeyValueForEntityAttributeWithValue(NSEntityDescription *entity, NSString *attribute, id value)
+/**
+ Returns the given value coerced to the class Core Data uses for attributes of the given type, so that a numeric attribute can be looked up by a string representation of its value and vice versa. Values that cannot be coerced are returned unchanged and will not match any cached value.
+ */
+static id RKCacheKeyValueForAttributeType(NSAttributeType attributeType, id value)
 {
-    if ([value isKindOfClass:[NSString class]] || [value isEqual:[NSNull null]]) {
-        return value;
+    switch (attributeType) {
+        case NSInteger16AttributeType:
+        case NSInteger32AttributeType:
+        case NSInteger64AttributeType:
+            if ([value isKindOfClass:[NSString class]]) {
+                long long integerValue;
+                NSScanner *scanner = [NSScanner scannerWithString:value];
+                if ([scanner scanLongLong:&integerValue] && [scanner isAtEnd]) return @(integerValue);
+            }
+            break;
+
+        case NSDoubleAttributeType:
+        case NSFloatAttributeType:
+            if ([value isKindOfClass:[NSString class]]) {
+                double doubleValue;
+                NSScanner *scanner = [NSScanner scannerWithString:value];
+                if ([scanner scanDouble:&doubleValue] && [scanner isAtEnd]) return @(doubleValue);
+            }
+            break;
+
+        case NSDecimalAttributeType:
+            if ([value isKindOfClass:[NSString class]]) {
+                NSDecimalNumber *decimalNumber = [NSDecimalNumber decimalNumberWithString:value];
+                if (! [decimalNumber isEqualToNumber:[NSDecimalNumber notANumber]]) return decimalNumber;
+            }
+            break;
+
+        case NSBooleanAttributeType:
+            if ([value isKindOfClass:[NSString class]]) return @([value boolValue]);
+            break;
+
+        case NSStringAttributeType:
+            if ([value isKindOfClass:[NSNumber class]]) return [value stringValue];
+            break;
+
+        default:
+            break;
     }
-    return [value respondsToSelector:@selector(stringValue)] ? [value stringValue] : value;
+
+    return value;
 }
 
-static NSString *RKCacheKeyForEntityWithAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+/**
+ An immutable composite key for the values of the cache attributes of an object. Values are held in the attribute order fixed when the cache was created, the hash is computed once and equality compares each value with `isEqual:` so that values of different types never collide.
+ */
+@interface RKEntityCacheKey : NSObject <NSCopying>
+@property (nonatomic, strong, readonly) id value;
+@property (nonatomic, copy, readonly) NSArray *values;
+@property (nonatomic, assign, readonly) NSUInteger precomputedHash;
+
+- (id)initWithValues:(NSArray *)values;
+- (NSArray *)allValues;
+@end
+
+@implementation RKEntityCacheKey
+
+- (id)initWithValues:(NSArray *)values
 {
-    // Performance optimization
-    if ([attributeValues count] == 1) return [[[attributeValues allValues] lastObject] description];
-    NSArray *sortedAttributes = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
-    NSMutableArray *sortedValues = [NSMutableArray arrayWithCapacity:[sortedAttributes count]];
-    for (NSString *attributeName in sortedAttributes) {
-        id cacheKeyValue = RKCacheKeyValueForEntityAttributeWithValue(entity, attributeName, [attributeValues objectForKey:attributeName]);
-        [sortedValues addObject:cacheKeyValue];
-    };
-    
-    return [sortedValues componentsJoinedByString:@":"];
+    self = [super init];
+    if (self) {
+        // A single attribute key holds its value directly to avoid retaining an array for the most common case
+        if ([values count] == 1) {
+            _value = [values lastObject];
+            _precomputedHash = [_value hash];
+        } else {
+            _values = [values copy];
+            for (id value in _values) _precomputedHash = (_precomputedHash * 31) + [value hash];
+        }
+    }
+
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    return self;
+}
+
+- (NSUInteger)hash
+{
+    return self.precomputedHash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (! [object isKindOfClass:[RKEntityCacheKey class]]) return NO;
+    RKEntityCacheKey *otherKey = object;
+    if (self.precomputedHash != otherKey.precomputedHash) return NO;
+    if (self.value) return [self.value isEqual:otherKey.value];
+    return [self.values isEqualToArray:otherKey.values];
+}
+
+- (NSArray *)allValues
+{
+    return self.values ?: @[ self.value ];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@>", NSStringFromClass([self class]), self, self.values ?: self.value];
+}
+
+@end
+
+// The number of object IDs materialized by a single fetch request, which keeps the `IN` predicate within the host parameter limit of SQLite
+static NSUInteger const RKEntityByAttributeCacheFetchBatchSize = 500;
+
+// The number of fetched rows merged into the cache at a time while loading
+static NSUInteger const RKEntityByAttributeCacheLoadBatchSize = 1000;
+
+static BOOL RKObjectIDsContainTemporaryID(NSSet *objectIDs)
+{
+    for (NSManagedObjectID *objectID in objectIDs) {
+        if ([objectID isTemporaryID]) return YES;
+    }
+    return NO;
 }
 
 /*
- This function recursively calculates a set of cache keys given a dictionary of attribute values. The basic premise is that we wish to decompose all arrays of values within the dictionary into a distinct cache key, as each object within the cache will appear for only one key.
+ Returns the previous values of those of the given attributes that have changed on the managed object, with `NSNull` standing in for `nil`. The values are read from `changedValuesForCurrentEvent`, which holds the values of the properties that changed since the last `NSManagedObjectContextObjectsDidChangeNotification`. Where it is unavailable, the changes since the last save are considered instead and the previous values are read from `committedValuesForKeys:`.
  */
-static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+static NSDictionary *RKPreviousValuesOfChangedAttributes(NSManagedObject *managedObject, NSArray *attributeNames)
 {
-    NSMutableArray *cacheKeys = [NSMutableArray array];
-    NSSet *collectionKeys = [attributeValues keysOfEntriesPassingTest:^BOOL(id key, id obj, BOOL *stop) {
-        return RKObjectIsCollection(obj);
-    }];
+    if ([managedObject respondsToSelector:@selector(changedValuesForCurrentEvent)]) {
+        NSDictionary *changedValues = [managedObject changedValuesForCurrentEvent];
+        NSMutableDictionary *previousValues = [NSMutableDictionary dictionary];
+        for (NSString *attributeName in attributeNames) {
+            id value = [changedValues objectForKey:attributeName];
+            if (value) [previousValues setObject:value forKey:attributeName];
+        }
+        return previousValues;
+    }
 
-    if ([collectionKeys count] > 0) {
-        for (NSString *attributeName in collectionKeys) {
-            id attributeValue = [attributeValues objectForKey:attributeName];
-            for (id value in attributeValue) {
-                NSMutableDictionary *mutableAttributeValues = [attributeValues mutableCopy];
-                [mutableAttributeValues setValue:value forKey:attributeName];
-                [cacheKeys addObjectsFromArray:RKCacheKeysForEntityFromAttributeValues(entity, mutableAttributeValues)];
-            }
+    NSDictionary *changedValues = [managedObject changedValues];
+    NSMutableArray *changedAttributeNames = [NSMutableArray array];
+    for (NSString *attributeName in attributeNames) {
+        if ([changedValues objectForKey:attributeName]) [changedAttributeNames addObject:attributeName];
+    }
+    if ([changedAttributeNames count] == 0) return nil;
+    NSMutableDictionary *previousValues = [NSMutableDictionary dictionaryWithCapacity:[changedAttributeNames count]];
+    NSDictionary *committedValues = [managedObject committedValuesForKeys:changedAttributeNames];
+    for (NSString *attributeName in changedAttributeNames) {
+        [previousValues setObject:[committedValues objectForKey:attributeName] ?: [NSNull null] forKey:attributeName];
+    }
+    return previousValues;
+}
+
+/**
+ The object IDs cached for a key of an `RKEntityCacheShard`, along with the CLOCK reference bit of the key. The object IDs are guarded by the lock of the shard. The reference bit is set atomically by lookups, which only hold the lock for reading, and is cleared by the clock hand while holding the lock for writing.
+ */
+@interface RKEntityCacheBucket : NSObject {
+    volatile uint32_t _referenced;
+}
+@property (nonatomic, strong, readonly) NSMutableSet *objectIDs;
+
+- (id)initWithObjectID:(NSManagedObjectID *)objectID;
+- (void)markReferenced;
+- (BOOL)clearReferenced;
+@end
+
+@implementation RKEntityCacheBucket
+
+- (id)initWithObjectID:(NSManagedObjectID *)objectID
+{
+    self = [super init];
+    if (self) {
+        _objectIDs = [NSMutableSet setWithObject:objectID];
+    }
+    return self;
+}
+
+// Only writes the bit when it is clear, so that repeated hits of a key do not contend on its cache line
+- (void)markReferenced
+{
+    if (! _referenced) OSAtomicOr32Barrier(1, &_referenced);
+}
+
+// Returns whether the bit was set
+- (BOOL)clearReferenced
+{
+    return OSAtomicAnd32OrigBarrier(0, &_referenced) != 0;
+}
+
+@end
+
+/**
+ A partition of the key space of an `RKEntityByAttributeCache`. Each shard guards its associations with its own read-write lock, so that lookups of keys in different shards never contend and a mutation only excludes the readers of the shard it changes. Each shard keeps the CLOCK state of its own keys, and the cache sweeps the shards in turn when it exceeds its limit.
+
+ All properties other than the statistics must be accessed while holding the lock: for reading when inspecting associations and for writing when changing them.
+ */
+@interface RKEntityCacheShard : NSObject {
+    pthread_rwlock_t _lock;
+    volatile int64_t _hitCount;
+    volatile int64_t _missCount;
+}
+@property (nonatomic, strong, readonly) NSMutableDictionary *cacheKeysToBuckets;
+@property (nonatomic, assign) NSUInteger objectIDCount;
+@property (nonatomic, strong, readonly) NSMutableArray *clockCacheKeys;
+@property (nonatomic, assign) NSUInteger clockHand;
+@property (nonatomic, assign, getter = isComplete) BOOL complete;
+@property (nonatomic, assign) NSUInteger evictionCount;
+@property (nonatomic, strong, readonly) NSMutableSet *faultedCacheKeys;
+
+- (void)lockForReading;
+- (void)lockForWriting;
+- (void)unlock;
+
+- (void)cacheObjectID:(NSManagedObjectID *)objectID forCacheKey:(RKEntityCacheKey *)cacheKey;
+- (void)deleteObjectID:(NSManagedObjectID *)objectID forCacheKey:(RKEntityCacheKey *)cacheKey;
+- (void)evictObjectIDs:(NSSet *)objectIDs forCacheKey:(RKEntityCacheKey *)cacheKey;
+- (NSUInteger)evictObjectIDCount:(NSUInteger)objectIDCount;
+- (void)reset;
+
+- (void)recordHitCount:(NSUInteger)hitCount missCount:(NSUInteger)missCount;
+- (NSUInteger)hitCount;
+- (NSUInteger)missCount;
+- (void)resetStatistics;
+@end
+
+@implementation RKEntityCacheShard
+
+- (id)init
+{
+    self = [super init];
+    if (self) {
+        pthread_rwlock_init(&_lock, NULL);
+        _cacheKeysToBuckets = [NSMutableDictionary dictionary];
+        _clockCacheKeys = [NSMutableArray array];
+        _faultedCacheKeys = [NSMutableSet set];
+        _complete = YES;
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    pthread_rwlock_destroy(&_lock);
+}
+
+- (void)lockForReading
+{
+    pthread_rwlock_rdlock(&_lock);
+}
+
+- (void)lockForWriting
+{
+    pthread_rwlock_wrlock(&_lock);
+}
+
+- (void)unlock
+{
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)cacheObjectID:(NSManagedObjectID *)objectID forCacheKey:(RKEntityCacheKey *)cacheKey
+{
+    NSMutableSet *objectIDs = [[self.cacheKeysToBuckets objectForKey:cacheKey] objectIDs];
+    if (objectIDs) {
+        if (! [objectIDs containsObject:objectID]) {
+            [objectIDs addObject:objectID];
+            self.objectIDCount++;
         }
     } else {
-        [cacheKeys addObject:RKCacheKeyForEntityWithAttributeValues(entity, attributeValues)];
+        [self.cacheKeysToBuckets setObject:[[RKEntityCacheBucket alloc] initWithObjectID:objectID] forKey:cacheKey];
+        [self.clockCacheKeys addObject:cacheKey];
+        self.objectIDCount++;
     }
+}
 
-    return cacheKeys;
+- (void)deleteObjectID:(NSManagedObjectID *)objectID forCacheKey:(RKEntityCacheKey *)cacheKey
+{
+    NSMutableSet *objectIDs = [[self.cacheKeysToBuckets objectForKey:cacheKey] objectIDs];
+    if (objectIDs && [objectIDs containsObject:objectID]) {
+        [objectIDs removeObject:objectID];
+        self.objectIDCount--;
+    }
+}
+
+- (void)evictObjectIDs:(NSSet *)objectIDs forCacheKey:(RKEntityCacheKey *)cacheKey
+{
+    NSMutableSet *cachedObjectIDs = [[self.cacheKeysToBuckets objectForKey:cacheKey] objectIDs];
+    NSUInteger count = [cachedObjectIDs count];
+    [cachedObjectIDs minusSet:objectIDs];
+    self.objectIDCount -= (count - [cachedObjectIDs count]);
+}
+
+/*
+ Advances the clock hand by at most one revolution, clearing set reference bits and evicting the attribute values whose bit is clear, until the given number of object IDs has been evicted. Returns the number of object IDs evicted.
+ */
+- (NSUInteger)evictObjectIDCount:(NSUInteger)objectIDCount
+{
+    NSUInteger evictedObjectIDCount = 0;
+    NSUInteger stepCount = [self.clockCacheKeys count];
+    for (NSUInteger step = 0; step < stepCount && evictedObjectIDCount < objectIDCount; step++) {
+        if (self.clockHand >= [self.clockCacheKeys count]) self.clockHand = 0;
+        RKEntityCacheKey *cacheKey = [self.clockCacheKeys objectAtIndex:self.clockHand];
+        RKEntityCacheBucket *bucket = [self.cacheKeysToBuckets objectForKey:cacheKey];
+        NSSet *objectIDs = bucket.objectIDs;
+        if ([bucket clearReferenced] || RKObjectIDsContainTemporaryID(objectIDs)) {
+            self.clockHand++;
+            continue;
+        }
+
+        evictedObjectIDCount += [objectIDs count];
+        self.objectIDCount -= [objectIDs count];
+        [self.cacheKeysToBuckets removeObjectForKey:cacheKey];
+        // Fill the vacated slot with the last key rather than shifting the remainder of the clock
+        [self.clockCacheKeys replaceObjectAtIndex:self.clockHand withObject:[self.clockCacheKeys lastObject]];
+        [self.clockCacheKeys removeLastObject];
+        self.evictionCount++;
+        self.complete = NO;
+    }
+
+    return evictedObjectIDCount;
+}
+
+- (void)reset
+{
+    [self.cacheKeysToBuckets removeAllObjects];
+    [self.clockCacheKeys removeAllObjects];
+    self.objectIDCount = 0;
+    self.clockHand = 0;
+    self.complete = YES;
+    [self.faultedCacheKeys removeAllObjects];
+}
+
+// Lookups only hold the lock for reading, so the statistics are maintained atomically
+- (void)recordHitCount:(NSUInteger)hitCount missCount:(NSUInteger)missCount
+{
+    if (hitCount) OSAtomicAdd64Barrier(hitCount, &_hitCount);
+    if (missCount) OSAtomicAdd64Barrier(missCount, &_missCount);
+}
+
+- (NSUInteger)hitCount
+{
+    return (NSUInteger)OSAtomicAdd64Barrier(0, &_hitCount);
+}
+
+- (NSUInteger)missCount
+{
+    return (NSUInteger)OSAtomicAdd64Barrier(0, &_missCount);
+}
+
+- (void)resetStatistics
+{
+    OSAtomicAdd64Barrier(-OSAtomicAdd64Barrier(0, &_hitCount), &_hitCount);
+    OSAtomicAdd64Barrier(-OSAtomicAdd64Barrier(0, &_missCount), &_missCount);
+    [self lockForWriting];
+    self.evictionCount = 0;
+    [self unlock];
 }
 
-@interface RKEntityByAttributeCache ()
-@property (nonatomic, strong) NSMutableDictionary *cacheKeysToObjectIDs;
-#if OS_OBJECT_USE_OBJC
-@property (nonatomic, strong) dispatch_queue_t queue;
-#else
-@property (nonatomic, assign) dispatch_queue_t queue;
-#endif
+@end
+
+// The number of shards the key space of a cache is partitioned into
+static NSUInteger const RKEntityByAttributeCacheShardCount = 16;
+
+@interface RKEntityByAttributeCache () {
+    volatile int64_t _objectIDCount;
+}
+@property (nonatomic, copy) NSArray *attributeTypes;
+@property (nonatomic, copy) NSArray *shards;
+@property (nonatomic, assign) NSUInteger shardClockHand;
+@property (atomic, assign) BOOL loadFinished;
+@property (atomic, strong) RKEntityIdentityIndex *identityIndex;
 @end
 
 @implementation RKEntityByAttributeCache
@@ -103,8 +424,18 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
         _entity = entity;
         _attributes = attributeNames;
         _managedObjectContext = context;
-        NSString *queueName = [[NSString alloc] initWithFormat:@"%@.%p", @"org.restkit.core-data.entity-by-attribute-cache", self];
-        self.queue = dispatch_queue_create([queueName UTF8String], DISPATCH_QUEUE_CONCURRENT);        
+        NSDictionary *attributesByName = [entity attributesByName];
+        NSMutableArray *attributeTypes = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+        for (NSString *attributeName in attributeNames) {
+            NSAttributeDescription *attribute = [attributesByName objectForKey:attributeName];
+            [attributeTypes addObject:@(attribute ? [attribute attributeType] : NSUndefinedAttributeType)];
+        }
+        self.attributeTypes = attributeTypes;
+        NSMutableArray *shards = [NSMutableArray arrayWithCapacity:RKEntityByAttributeCacheShardCount];
+        for (NSUInteger i = 0; i < RKEntityByAttributeCacheShardCount; i++) {
+            [shards addObject:[RKEntityCacheShard new]];
+        }
+        self.shards = shards;
 
 #if TARGET_OS_IPHONE
         [[NSNotificationCenter defaultCenter] addObserver:self
@@ -120,29 +451,104 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 - (void)dealloc
 {
     [[NSNotificationCenter defaultCenter] removeObserver:self];
-    
-#if !OS_OBJECT_USE_OBJC
-    dispatch_release(_queue);
-    _queue = NULL;
-#endif
     _callbackQueue = NULL;
 }
 
+- (RKEntityCacheKey *)cacheKeyForAttributeValues:(NSDictionary *)attributeValues
+{
+    NSUInteger count = [self.attributes count];
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        id value = [attributeValues objectForKey:[self.attributes objectAtIndex:i]] ?: [NSNull null];
+        [values addObject:RKCacheKeyValueForAttributeType([[self.attributeTypes objectAtIndex:i] unsignedIntegerValue], value)];
+    }
+    return [[RKEntityCacheKey alloc] initWithValues:values];
+}
+
+/*
+ Calculates the set of cache keys for a dictionary of attribute values. Any collection of values within the dictionary is decomposed into one cache key per value, as each object within the cache will appear for only one key. A dictionary that does not provide a value for every cache attribute has no cache keys.
+ */
+- (NSArray *)cacheKeysForAttributeValues:(NSDictionary *)attributeValues
+{
+    NSUInteger count = [self.attributes count];
+    if (count == 1) {
+        id attributeValue = [attributeValues objectForKey:[self.attributes lastObject]];
+        if (attributeValue && ! RKObjectIsCollection(attributeValue)) return @[ [self cacheKeyForAttributeValues:attributeValues] ];
+    }
+    NSMutableArray *combinations = [NSMutableArray arrayWithObject:[NSArray array]];
+    for (NSUInteger i = 0; i < count; i++) {
+        id attributeValue = [attributeValues objectForKey:[self.attributes objectAtIndex:i]];
+        if (attributeValue == nil) return @[];
+        NSAttributeType attributeType = [[self.attributeTypes objectAtIndex:i] unsignedIntegerValue];
+        id values = RKObjectIsCollection(attributeValue) ? attributeValue : @[ attributeValue ];
+        NSMutableArray *expandedCombinations = [NSMutableArray arrayWithCapacity:[combinations count] * [values count]];
+        for (NSArray *combination in combinations) {
+            for (id value in values) {
+                [expandedCombinations addObject:[combination arrayByAddingObject:RKCacheKeyValueForAttributeType(attributeType, value)]];
+            }
+        }
+        combinations = expandedCombinations;
+    }
+
+    NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[combinations count]];
+    for (NSArray *combination in combinations) {
+        [cacheKeys addObject:[[RKEntityCacheKey alloc] initWithValues:combination]];
+    }
+    return cacheKeys;
+}
+
+- (RKEntityCacheShard *)shardForCacheKey:(RKEntityCacheKey *)cacheKey
+{
+    return [self.shards objectAtIndex:[cacheKey hash] % [self.shards count]];
+}
+
+/*
+ Partitions the given cache keys, and the objects corresponding to them, by the shard that holds them and invokes the block once for each shard involved, so that every shard is locked at most once per operation.
+ */
+- (void)enumerateShardsForCacheKeys:(NSArray *)cacheKeys objects:(NSArray *)objects usingBlock:(void (^)(RKEntityCacheShard *shard, NSArray *cacheKeys, NSArray *objects))block
+{
+    if ([cacheKeys count] == 1) {
+        block([self shardForCacheKey:[cacheKeys lastObject]], cacheKeys, objects);
+        return;
+    }
+
+    NSUInteger shardCount = [self.shards count];
+    NSMutableArray *cacheKeysByShard = [NSMutableArray arrayWithCapacity:shardCount];
+    NSMutableArray *objectsByShard = [NSMutableArray arrayWithCapacity:shardCount];
+    for (NSUInteger i = 0; i < shardCount; i++) {
+        [cacheKeysByShard addObject:[NSMutableArray array]];
+        [objectsByShard addObject:[NSMutableArray array]];
+    }
+    [cacheKeys enumerateObjectsUsingBlock:^(RKEntityCacheKey *cacheKey, NSUInteger idx, BOOL *stop) {
+        NSUInteger shardIndex = [cacheKey hash] % shardCount;
+        [[cacheKeysByShard objectAtIndex:shardIndex] addObject:cacheKey];
+        if (objects) [[objectsByShard objectAtIndex:shardIndex] addObject:[objects objectAtIndex:idx]];
+    }];
+    for (NSUInteger i = 0; i < shardCount; i++) {
+        NSArray *shardCacheKeys = [cacheKeysByShard objectAtIndex:i];
+        if ([shardCacheKeys count]) block([self.shards objectAtIndex:i], shardCacheKeys, objects ? [objectsByShard objectAtIndex:i] : nil);
+    }
+}
+
 - (NSUInteger)count
 {
-    __block NSUInteger count;
-    dispatch_sync(self.queue, ^{
-        count = [[[self.cacheKeysToObjectIDs allValues] valueForKeyPath:@"@sum.@count"] integerValue];
-    });
-    return count;
+    return (NSUInteger)OSAtomicAdd64Barrier(0, &_objectIDCount);
+}
+
+// Must be invoked while holding the lock of the shard whose count changed
+- (void)addToObjectIDCount:(NSInteger)delta
+{
+    if (delta) OSAtomicAdd64Barrier(delta, &_objectIDCount);
 }
 
 - (NSUInteger)countOfAttributeValues
 {
-    __block NSUInteger count;
-    dispatch_sync(self.queue, ^{
-        count = [self.cacheKeysToObjectIDs count];
-    });
+    NSUInteger count = 0;
+    for (RKEntityCacheShard *shard in self.shards) {
+        [shard lockForReading];
+        count += [shard.cacheKeysToBuckets count];
+        [shard unlock];
+    }
     return count;
 }
 
@@ -163,6 +569,8 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     fetchRequest.entity = self.entity;
     fetchRequest.resultType = NSDictionaryResultType;
     fetchRequest.propertiesToFetch = [self.attributes arrayByAddingObject:objectIDExpression];
+    // A bounded cache loads no more objects than it can retain and reloads the remainder on demand
+    fetchRequest.fetchLimit = self.maximumObjectIDCount;
 
     [self.managedObjectContext performBlock:^{
         NSError *error = nil;
@@ -173,144 +581,388 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             RKLogWarning(@"Failed to load entity cache. Failed to execute fetch request: %@", fetchRequest);
             RKLogCoreDataError(error);
         }
-        
-        dispatch_barrier_async(self.queue, ^{
-            RKLogDebug(@"Loading entity cache for Entity '%@' by attributes '%@' in managed object context %@ (concurrencyType = %ld)",
-                       self.entity.name, self.attributes, self.managedObjectContext, (unsigned long)self.managedObjectContext.concurrencyType);
-            self.cacheKeysToObjectIDs = [NSMutableDictionary dictionary];
-            for (NSDictionary *dictionary in dictionaries) {
-                NSManagedObjectID *objectID = [dictionary objectForKey:@"objectID"];
-                NSDictionary *attributeValues = [dictionary dictionaryWithValuesForKeys:self.attributes];
-                [self cacheObjectID:objectID forAttributeValues:attributeValues];
-            }
-            
-            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-        });
+
+        RKLogDebug(@"Loading entity cache for Entity '%@' by attributes '%@' in managed object context %@ (concurrencyType = %ld)",
+                   self.entity.name, self.attributes, self.managedObjectContext, (unsigned long)self.managedObjectContext.concurrencyType);
+        BOOL isTruncated = (fetchRequest.fetchLimit && [dictionaries count] >= fetchRequest.fetchLimit);
+        [self loadDictionaries:dictionaries fromIndex:0 isTruncated:isTruncated completion:completion];
      }];
 }
 
+/*
+ Merges the results of the load fetch into the cache in slices. The fetch itself returns every row at once, as `fetchBatchSize` has no effect on dictionary results, but each slice is merged in its own block on the queue of the context, after which the next slice is enqueued, so that the context remains available to other work while the results are merged. Only the shards touched by a slice are locked while it is merged. Associations added while the cache is loading are merged rather than replaced.
+ */
+- (void)loadDictionaries:(NSArray *)dictionaries fromIndex:(NSUInteger)index isTruncated:(BOOL)isTruncated completion:(void (^)(void))completion
+{
+    NSUInteger count = [dictionaries count];
+    NSRange range = NSMakeRange(index, MIN(RKEntityByAttributeCacheLoadBatchSize, count - index));
+    @autoreleasepool {
+        NSMutableDictionary *objectIDsToAttributeValues = [NSMutableDictionary dictionaryWithCapacity:range.length];
+        for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+            NSDictionary *dictionary = [dictionaries objectAtIndex:i];
+            [objectIDsToAttributeValues setObject:[dictionary dictionaryWithValuesForKeys:self.attributes] forKey:[dictionary objectForKey:@"objectID"]];
+        }
+        [self cacheObjectIDsWithAttributeValues:objectIDsToAttributeValues];
+    }
+
+    if (NSMaxRange(range) < count) {
+        [self.managedObjectContext performBlock:^{
+            [self loadDictionaries:dictionaries fromIndex:NSMaxRange(range) isTruncated:isTruncated completion:completion];
+        }];
+        return;
+    }
+
+    if (isTruncated) {
+        for (RKEntityCacheShard *shard in self.shards) {
+            [shard lockForWriting];
+            shard.complete = NO;
+            [shard unlock];
+        }
+    }
+    self.loadFinished = YES;
+    if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+}
+
 - (void)flush:(void (^)(void))completion
 {
-    dispatch_barrier_async(self.queue, ^{
-        RKLogDebug(@"Flushing entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
-        self.cacheKeysToObjectIDs = nil;
-        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-    });
+    RKLogDebug(@"Flushing entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
+    self.loadFinished = NO;
+    self.identityIndex = nil;
+    for (RKEntityCacheShard *shard in self.shards) {
+        [shard lockForWriting];
+        [self addToObjectIDCount:-(NSInteger)shard.objectIDCount];
+        [shard reset];
+        [shard unlock];
+    }
+    if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
 }
 
-- (BOOL)isLoaded
+- (void)setMaximumObjectIDCount:(NSUInteger)maximumObjectIDCount
 {
-    __block BOOL isLoaded;
-    dispatch_sync(self.queue, ^{
-        isLoaded = (self.cacheKeysToObjectIDs != nil);
-    });
-    return isLoaded;
+    _maximumObjectIDCount = maximumObjectIDCount;
+    [self evictCacheKeysIfNecessary];
 }
 
-- (NSManagedObject *)objectForObjectID:(NSManagedObjectID *)objectID inContext:(NSManagedObjectContext *)context
+/*
+ Sweeps the shards in turn, advancing the clock of each, until the number of cached object IDs is within the limit. A referenced key is spared by the first pass of the clock of its shard, so the sweep ends once every shard has been visited twice without evicting anything. Evictions are serialized with one another, but each shard is only locked while its own clock advances.
+ */
+- (void)evictCacheKeysIfNecessary
 {
-    /**
-     NOTE:
+    NSUInteger maximumObjectIDCount = self.maximumObjectIDCount;
+    if (maximumObjectIDCount == 0 || [self count] <= maximumObjectIDCount) return;
 
-     We use `existingObjectWithID:` as opposed to `objectWithID:` as `objectWithID:` can return us a fault
-     that will raise an exception when fired. `existingObjectWithID:error:` will return nil if the ID has been
-     deleted. `objectRegisteredForID:` is also an acceptable approach.
-     */
-    __block NSError *error = nil;
-    __block NSManagedObject *object;
-    [context performBlockAndWait:^{
-        object = [context existingObjectWithID:objectID error:&error];
-    }];
-    if (! object) {
-        // Referential integrity errors often indicates that the temporary objectID does not exist in the specified context
-        if (error && !([objectID isTemporaryID] && [error code] == NSManagedObjectReferentialIntegrityError)) {
-            RKLogError(@"Failed to retrieve managed object with ID %@. Error %@\n%@", objectID, [error localizedDescription], [error userInfo]);
+    NSUInteger evictedObjectIDCount = 0;
+    @synchronized(self.shards) {
+        NSUInteger shardCount = [self.shards count];
+        NSUInteger idleShardCount = 0;
+        while (idleShardCount < shardCount * 2) {
+            NSUInteger count = [self count];
+            if (count <= maximumObjectIDCount) break;
+            RKEntityCacheShard *shard = [self.shards objectAtIndex:self.shardClockHand];
+            self.shardClockHand = (self.shardClockHand + 1) % shardCount;
+            [shard lockForWriting];
+            NSUInteger shardEvictedObjectIDCount = [shard evictObjectIDCount:count - maximumObjectIDCount];
+            [self addToObjectIDCount:-(NSInteger)shardEvictedObjectIDCount];
+            [shard unlock];
+            evictedObjectIDCount += shardEvictedObjectIDCount;
+            idleShardCount = shardEvictedObjectIDCount ? 0 : idleShardCount + 1;
         }
     }
-    return object;
+    if (evictedObjectIDCount) {
+        RKLogDebug(@"Evicted %ld objectIDs from entity cache for Entity '%@' by attributes '%@' to remain within %ld objectIDs",
+                   (long)evictedObjectIDCount, self.entity.name, self.attributes, (long)maximumObjectIDCount);
+    }
 }
 
-- (NSManagedObject *)objectWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
+- (NSUInteger)hitCount
 {
-    NSSet *objects = [self objectsWithAttributeValues:attributeValues inContext:context];
-    return ([objects count] > 0) ? [objects anyObject] : nil;
+    return [[self.shards valueForKeyPath:@"@sum.hitCount"] unsignedIntegerValue];
 }
 
-- (NSSet *)objectsWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
+- (NSUInteger)missCount
 {
-    NSMutableSet *objects = [NSMutableSet set];
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
-        __block NSSet *objectIDs = nil;
-        dispatch_sync(self.queue, ^{
-            objectIDs = [[NSSet alloc] initWithSet:[self.cacheKeysToObjectIDs objectForKey:cacheKey] copyItems:YES];
-        });
-        if ([objectIDs count]) {
+    return [[self.shards valueForKeyPath:@"@sum.missCount"] unsignedIntegerValue];
+}
+
+- (NSUInteger)evictionCount
+{
+    NSUInteger evictionCount = 0;
+    for (RKEntityCacheShard *shard in self.shards) {
+        [shard lockForReading];
+        evictionCount += shard.evictionCount;
+        [shard unlock];
+    }
+    return evictionCount;
+}
+
+- (void)resetStatistics
+{
+    [self.shards makeObjectsPerformSelector:@selector(resetStatistics)];
+}
+
+- (BOOL)isLoaded
+{
+    return self.loadFinished;
+}
+
+/*
+ Materializes the given object IDs with a single hop onto the queue of the context. Objects already registered with the context are used directly, the remaining permanent IDs are fetched in batches with a `self IN %@` predicate, and temporary IDs, which cannot be fetched, are resolved with `existingObjectWithID:error:`. IDs that no longer resolve to an object are returned by reference so that they can be evicted.
+ */
+- (NSSet *)objectsForObjectIDs:(NSSet *)objectIDs inContext:(NSManagedObjectContext *)context staleObjectIDs:(NSSet **)staleObjectIDs
+{
+    NSMutableSet *objects = [NSMutableSet setWithCapacity:[objectIDs count]];
+    NSMutableSet *missingObjectIDs = [NSMutableSet set];
+    [context performBlockAndWait:^{
+        NSMutableArray *objectIDsToFetch = [NSMutableArray array];
+        for (NSManagedObjectID *objectID in objectIDs) {
             /**
              NOTE:
-             In my benchmarking, retrieving the objects one at a time using existingObjectWithID: is significantly faster
-             than issuing a single fetch request against all object ID's.
+
+             We avoid `objectWithID:` as it can return us a fault that will raise an exception when fired. A registered
+             object that is still a fault may have been deleted, so it is fetched to verify that it exists.
              */
-            for (NSManagedObjectID *objectID in objectIDs) {
-                NSManagedObject *object = [self objectForObjectID:objectID inContext:context];
+            NSManagedObject *object = [context objectRegisteredForID:objectID];
+            if (object && ![object isFault]) {
+                [objects addObject:object];
+            } else if ([objectID isTemporaryID]) {
+                NSError *error = nil;
+                object = [context existingObjectWithID:objectID error:&error];
                 if (object) {
                     [objects addObject:object];
                 } else {
-                    RKLogDebug(@"Evicting objectID association for attributes %@ of Entity '%@': %@", attributeValues, self.entity.name, objectID);
-                    [self evictObjectID:objectID forAttributeValues:attributeValues];
+                    // Referential integrity errors often indicates that the temporary objectID does not exist in the specified context
+                    if (error && [error code] != NSManagedObjectReferentialIntegrityError) {
+                        RKLogError(@"Failed to retrieve managed object with ID %@. Error %@\n%@", objectID, [error localizedDescription], [error userInfo]);
+                    }
+                    [missingObjectIDs addObject:objectID];
                 }
+            } else {
+                [objectIDsToFetch addObject:objectID];
             }
         }
-    }
+
+        for (NSUInteger location = 0; location < [objectIDsToFetch count]; location += RKEntityByAttributeCacheFetchBatchSize) {
+            NSRange range = NSMakeRange(location, MIN(RKEntityByAttributeCacheFetchBatchSize, [objectIDsToFetch count] - location));
+            NSArray *batch = [objectIDsToFetch subarrayWithRange:range];
+            NSFetchRequest *fetchRequest = [[NSFetchRequest alloc] init];
+            fetchRequest.entity = self.entity;
+            fetchRequest.predicate = [NSPredicate predicateWithFormat:@"self IN %@", batch];
+            fetchRequest.returnsObjectsAsFaults = NO;
+            NSError *error = nil;
+            NSArray *fetchedObjects = [context executeFetchRequest:fetchRequest error:&error];
+            if (! fetchedObjects) {
+                RKLogError(@"Failed to retrieve %ld managed objects by ID. Error %@\n%@", (long)[batch count], [error localizedDescription], [error userInfo]);
+                continue;
+            }
+            [objects addObjectsFromArray:fetchedObjects];
+            NSMutableSet *unfetchedObjectIDs = [NSMutableSet setWithArray:batch];
+            [unfetchedObjectIDs minusSet:[NSSet setWithArray:[fetchedObjects valueForKey:@"objectID"]]];
+            [missingObjectIDs unionSet:unfetchedObjectIDs];
+        }
+    }];
+
+    if (staleObjectIDs) *staleObjectIDs = missingObjectIDs;
     return objects;
 }
 
-- (void)cacheObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
+- (NSManagedObject *)objectWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
 {
-    NSParameterAssert(objectID);
-    NSParameterAssert(attributeValues);
-    NSString *cacheKey = RKCacheKeyForEntityWithAttributeValues(self.entity, attributeValues);
-    NSMutableSet *objectIDs = [self.cacheKeysToObjectIDs objectForKey:cacheKey];
-    if (objectIDs) {
-        if (! [objectIDs containsObject:objectID]) {
-            [objectIDs addObject:objectID];
+    NSSet *objects = [self objectsWithAttributeValues:attributeValues inContext:context];
+    return ([objects count] > 0) ? [objects anyObject] : nil;
+}
+
+/*
+ Collects the object IDs cached for the given keys, holding the lock of each shard involved for reading. Keys that miss a shard that is no longer conclusive are returned by reference so that they can be reloaded.
+ */
+- (NSSet *)cachedObjectIDsForCacheKeys:(NSArray *)cacheKeys missedCacheKeys:(NSMutableArray *)missedCacheKeys
+{
+    NSMutableSet *objectIDs = [NSMutableSet set];
+    BOOL isBounded = (self.maximumObjectIDCount > 0);
+    RKEntityIdentityIndex *identityIndex = self.identityIndex;
+    __block BOOL faultedCacheKeys = NO;
+    [self enumerateShardsForCacheKeys:cacheKeys objects:nil usingBlock:^(RKEntityCacheShard *shard, NSArray *shardCacheKeys, NSArray *objects) {
+        NSUInteger hitCount = 0;
+        NSMutableArray *unfaultedCacheKeys = nil;
+        [shard lockForReading];
+        for (RKEntityCacheKey *cacheKey in shardCacheKeys) {
+            RKEntityCacheBucket *bucket = [shard.cacheKeysToBuckets objectForKey:cacheKey];
+            if (bucket) {
+                [objectIDs unionSet:bucket.objectIDs];
+                if (isBounded) [bucket markReferenced];
+                hitCount++;
+            } else if (identityIndex && ! [shard.faultedCacheKeys containsObject:cacheKey]) {
+                if (! unfaultedCacheKeys) unfaultedCacheKeys = [NSMutableArray array];
+                [unfaultedCacheKeys addObject:cacheKey];
+            } else if (! shard.isComplete) {
+                [missedCacheKeys addObject:cacheKey];
+            }
         }
-    } else {
-        objectIDs = [NSMutableSet setWithObject:objectID];
+        [shard unlock];
+
+        // Keys that have yet to be read from the identity index are faulted in under the write lock
+        if (unfaultedCacheKeys) {
+            [shard lockForWriting];
+            [self faultCacheKeys:unfaultedCacheKeys fromIdentityIndex:identityIndex intoShard:shard];
+            for (RKEntityCacheKey *cacheKey in unfaultedCacheKeys) {
+                RKEntityCacheBucket *bucket = [shard.cacheKeysToBuckets objectForKey:cacheKey];
+                if (bucket) {
+                    [objectIDs unionSet:bucket.objectIDs];
+                    if (isBounded) [bucket markReferenced];
+                    hitCount++;
+                } else if (! shard.isComplete) {
+                    [missedCacheKeys addObject:cacheKey];
+                }
+            }
+            [shard unlock];
+            faultedCacheKeys = YES;
+        }
+
+        [shard recordHitCount:hitCount missCount:[shardCacheKeys count] - hitCount];
+    }];
+    if (faultedCacheKeys) [self evictCacheKeysIfNecessary];
+    return objectIDs;
+}
+
+- (NSSet *)objectIDsWithAttributeValues:(NSDictionary *)attributeValues
+{
+    return [self cachedObjectIDsForCacheKeys:[self cacheKeysForAttributeValues:attributeValues] missedCacheKeys:nil];
+}
+
+- (NSSet *)objectsWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
+{
+    NSArray *cacheKeys = [self cacheKeysForAttributeValues:attributeValues];
+    NSMutableArray *missedCacheKeys = [NSMutableArray array];
+    NSSet *objectIDs = [self cachedObjectIDsForCacheKeys:cacheKeys missedCacheKeys:missedCacheKeys];
+
+    NSMutableSet *objects = [NSMutableSet set];
+    if ([missedCacheKeys count]) [objects unionSet:[self fetchObjectsForCacheKeys:missedCacheKeys inContext:context]];
+    if ([objectIDs count] == 0) return objects;
+
+    NSSet *staleObjectIDs = nil;
+    [objects unionSet:[self objectsForObjectIDs:objectIDs inContext:context staleObjectIDs:&staleObjectIDs]];
+    if ([staleObjectIDs count]) {
+        RKLogDebug(@"Evicting %ld objectID associations for attributes %@ of Entity '%@': %@", (long)[staleObjectIDs count], attributeValues, self.entity.name, staleObjectIDs);
+        [self evictObjectIDs:staleObjectIDs forCacheKeys:cacheKeys];
     }
-    
-    if (nil == self.cacheKeysToObjectIDs) self.cacheKeysToObjectIDs = [NSMutableDictionary dictionary];
-    [self.cacheKeysToObjectIDs setValue:objectIDs forKey:cacheKey];
+    return objects;
 }
 
-- (void)deleteObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
+- (NSPredicate *)predicateForCacheKeys:(NSArray *)cacheKeys
 {
-    NSParameterAssert(objectID);
-    NSParameterAssert(attributeValues);
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
-        NSMutableSet *objectIDs = [self.cacheKeysToObjectIDs objectForKey:cacheKey];
-        if (objectIDs && [objectIDs containsObject:objectID]) {
-            [objectIDs removeObject:objectID];
-        }
+    if ([self.attributes count] == 1) {
+        NSString *attributeName = [self.attributes lastObject];
+        NSMutableArray *values = [[cacheKeys valueForKey:@"value"] mutableCopy];
+        BOOL matchesNil = [values containsObject:[NSNull null]];
+        [values removeObject:[NSNull null]];
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values];
+        if (! matchesNil) return predicate;
+        return [NSCompoundPredicate orPredicateWithSubpredicates:@[ predicate, [NSPredicate predicateWithFormat:@"%K == nil", attributeName] ]];
+    }
+
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[cacheKeys count]];
+    for (RKEntityCacheKey *cacheKey in cacheKeys) {
+        NSMutableArray *attributePredicates = [NSMutableArray arrayWithCapacity:[self.attributes count]];
+        [cacheKey.values enumerateObjectsUsingBlock:^(id value, NSUInteger idx, BOOL *stop) {
+            [attributePredicates addObject:[NSPredicate predicateWithFormat:@"%K == %@", [self.attributes objectAtIndex:idx], (value == [NSNull null]) ? nil : value]];
+        }];
+        [subpredicates addObject:[NSCompoundPredicate andPredicateWithSubpredicates:attributePredicates]];
     }
+    return [NSCompoundPredicate orPredicateWithSubpredicates:subpredicates];
 }
 
-- (void)evictObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
+/*
+ Reloads attribute values that missed a cache that is no longer conclusive by fetching the matching objects in the given context. The objects are returned directly and their object IDs are added to the cache, with the misses that matched nothing left to be fetched again.
+ */
+- (NSSet *)fetchObjectsForCacheKeys:(NSArray *)cacheKeys inContext:(NSManagedObjectContext *)context
 {
-    if (attributeValues && [attributeValues count]) {
-        NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-        dispatch_barrier_async(self.queue, ^{
-            for (NSString *cacheKey in cacheKeys) {
-                NSMutableSet *objectIDs = [self.cacheKeysToObjectIDs objectForKey:cacheKey];
-                if (objectIDs && [objectIDs containsObject:objectID]) {
-                    [objectIDs removeObject:objectID];
-                }
+    NSMutableSet *objects = [NSMutableSet set];
+    NSMutableDictionary *objectIDsToAttributeValues = [NSMutableDictionary dictionary];
+    NSUInteger batchSize = MAX(RKEntityByAttributeCacheFetchBatchSize / [self.attributes count], 1);
+    [context performBlockAndWait:^{
+        for (NSUInteger location = 0; location < [cacheKeys count]; location += batchSize) {
+            NSArray *batch = [cacheKeys subarrayWithRange:NSMakeRange(location, MIN(batchSize, [cacheKeys count] - location))];
+            NSFetchRequest *fetchRequest = [[NSFetchRequest alloc] init];
+            fetchRequest.entity = self.entity;
+            fetchRequest.predicate = [self predicateForCacheKeys:batch];
+            fetchRequest.returnsObjectsAsFaults = NO;
+            NSError *error = nil;
+            NSArray *fetchedObjects = [context executeFetchRequest:fetchRequest error:&error];
+            if (! fetchedObjects) {
+                RKLogError(@"Failed to reload %ld attribute values for entity cache of Entity '%@'. Error %@\n%@", (long)[batch count], self.entity.name, [error localizedDescription], [error userInfo]);
+                continue;
             }
-        });
-    } else {
-        RKLogWarning(@"Unable to remove object for object ID %@: empty values dictionary for attributes '%@'", objectID, self.attributes);
-    }
+            for (NSManagedObject *managedObject in fetchedObjects) {
+                [objects addObject:managedObject];
+                [objectIDsToAttributeValues setObject:[managedObject dictionaryWithValuesForKeys:self.attributes] forKey:[managedObject objectID]];
+            }
+        }
+    }];
+
+    RKLogDebug(@"Reloaded %ld objects for %ld attribute values missing from entity cache for Entity '%@'", (long)[objects count], (long)[cacheKeys count], self.entity.name);
+    if ([objectIDsToAttributeValues count]) [self cacheObjectIDsWithAttributeValues:objectIDsToAttributeValues];
+    return objects;
+}
+
+- (void)cacheObjectIDsWithAttributeValues:(NSDictionary *)objectIDsToAttributeValues
+{
+    NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[objectIDsToAttributeValues count]];
+    NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[objectIDsToAttributeValues count]];
+    [objectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
+        [cacheKeys addObject:[self cacheKeyForAttributeValues:attributeValues]];
+        [objectIDs addObject:objectID];
+    }];
+
+    RKEntityIdentityIndex *identityIndex = self.identityIndex;
+    [self enumerateShardsForCacheKeys:cacheKeys objects:objectIDs usingBlock:^(RKEntityCacheShard *shard, NSArray *shardCacheKeys, NSArray *shardObjectIDs) {
+        [shard lockForWriting];
+        if (identityIndex) [self faultCacheKeys:shardCacheKeys fromIdentityIndex:identityIndex intoShard:shard];
+        NSUInteger objectIDCount = shard.objectIDCount;
+        [shardCacheKeys enumerateObjectsUsingBlock:^(RKEntityCacheKey *cacheKey, NSUInteger idx, BOOL *stop) {
+            [shard cacheObjectID:[shardObjectIDs objectAtIndex:idx] forCacheKey:cacheKey];
+        }];
+        [self addToObjectIDCount:(NSInteger)shard.objectIDCount - (NSInteger)objectIDCount];
+        [shard unlock];
+    }];
+    [self evictCacheKeysIfNecessary];
+}
+
+- (void)deleteObjectIDsWithAttributeValues:(NSDictionary *)objectIDsToAttributeValues
+{
+    NSMutableArray *cacheKeys = [NSMutableArray arrayWithCapacity:[objectIDsToAttributeValues count]];
+    NSMutableArray *objectIDs = [NSMutableArray arrayWithCapacity:[objectIDsToAttributeValues count]];
+    [objectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
+        for (RKEntityCacheKey *cacheKey in [self cacheKeysForAttributeValues:attributeValues]) {
+            [cacheKeys addObject:cacheKey];
+            [objectIDs addObject:objectID];
+        }
+    }];
+
+    RKEntityIdentityIndex *identityIndex = self.identityIndex;
+    [self enumerateShardsForCacheKeys:cacheKeys objects:objectIDs usingBlock:^(RKEntityCacheShard *shard, NSArray *shardCacheKeys, NSArray *shardObjectIDs) {
+        [shard lockForWriting];
+        if (identityIndex) [self faultCacheKeys:shardCacheKeys fromIdentityIndex:identityIndex intoShard:shard];
+        NSUInteger objectIDCount = shard.objectIDCount;
+        [shardCacheKeys enumerateObjectsUsingBlock:^(RKEntityCacheKey *cacheKey, NSUInteger idx, BOOL *stop) {
+            [shard deleteObjectID:[shardObjectIDs objectAtIndex:idx] forCacheKey:cacheKey];
+        }];
+        [self addToObjectIDCount:(NSInteger)shard.objectIDCount - (NSInteger)objectIDCount];
+        [shard unlock];
+    }];
+}
+
+- (void)evictObjectIDs:(NSSet *)objectIDs forCacheKeys:(NSArray *)cacheKeys
+{
+    RKEntityIdentityIndex *identityIndex = self.identityIndex;
+    [self enumerateShardsForCacheKeys:cacheKeys objects:nil usingBlock:^(RKEntityCacheShard *shard, NSArray *shardCacheKeys, NSArray *objects) {
+        [shard lockForWriting];
+        if (identityIndex) [self faultCacheKeys:shardCacheKeys fromIdentityIndex:identityIndex intoShard:shard];
+        NSUInteger objectIDCount = shard.objectIDCount;
+        for (RKEntityCacheKey *cacheKey in shardCacheKeys) {
+            [shard evictObjectIDs:objectIDs forCacheKey:cacheKey];
+        }
+        [self addToObjectIDCount:(NSInteger)shard.objectIDCount - (NSInteger)objectIDCount];
+        [shard unlock];
+    }];
 }
 
 - (void)addObjects:(NSSet *)managedObjects completion:(void (^)(void))completion
@@ -334,17 +986,8 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             [newObjectIDsToAttributeValues setObject:attributeValues forKey:objectID];
         }
         
-        if ([newObjectIDsToAttributeValues count]) {
-            dispatch_barrier_async(self.queue, ^{
-                [newObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
-                    [self cacheObjectID:objectID forAttributeValues:attributeValues];
-                }];
-                
-                if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-            });
-        } else {
-            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-        }
+        if ([newObjectIDsToAttributeValues count]) [self cacheObjectIDsWithAttributeValues:newObjectIDsToAttributeValues];
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
     }];
 }
 
@@ -369,20 +1012,139 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             [deletedObjectIDsToAttributeValues setObject:attributeValues forKey:objectID];
         }
         
-        if ([deletedObjectIDsToAttributeValues count]) {
-            dispatch_barrier_async(self.queue, ^{
-                [deletedObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
-                    [self deleteObjectID:objectID forAttributeValues:attributeValues];
-                }];
-                
-                if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-            });
-        } else {
-            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        if ([deletedObjectIDsToAttributeValues count]) [self deleteObjectIDsWithAttributeValues:deletedObjectIDsToAttributeValues];
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+    }];
+}
+
+- (void)updateObjects:(NSSet *)managedObjects completion:(void (^)(void))completion
+{
+    if ([managedObjects count] == 0) {
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        return;
+    }
+    NSManagedObjectContext *managedObjectContext = [[managedObjects anyObject] managedObjectContext];
+    [managedObjectContext performBlockAndWait:^{
+        NSMutableDictionary *previousObjectIDsToAttributeValues = [NSMutableDictionary dictionary];
+        NSMutableDictionary *newObjectIDsToAttributeValues = [NSMutableDictionary dictionary];
+        for (NSManagedObject *managedObject in managedObjects) {
+            NSAssert([managedObject.entity isKindOfEntity:self.entity], @"Cannot update object with entity '%@' in cache for entity of '%@'", [managedObject.entity name], [self.entity name]);
+            NSDictionary *previousAttributeValues = RKPreviousValuesOfChangedAttributes(managedObject, self.attributes);
+            if ([previousAttributeValues count] == 0) continue;
+
+            NSDictionary *attributeValues = [managedObject dictionaryWithValuesForKeys:self.attributes];
+            NSMutableDictionary *mutablePreviousAttributeValues = [attributeValues mutableCopy];
+            [mutablePreviousAttributeValues addEntriesFromDictionary:previousAttributeValues];
+            [previousObjectIDsToAttributeValues setObject:mutablePreviousAttributeValues forKey:[managedObject objectID]];
+            [newObjectIDsToAttributeValues setObject:attributeValues forKey:[managedObject objectID]];
+        }
+
+        if ([previousObjectIDsToAttributeValues count]) {
+            RKLogTrace(@"Moving %ld objects of Entity '%@' whose identifying attributes changed", (long)[previousObjectIDsToAttributeValues count], self.entity.name);
+            [self deleteObjectIDsWithAttributeValues:previousObjectIDsToAttributeValues];
+            [self cacheObjectIDsWithAttributeValues:newObjectIDsToAttributeValues];
         }
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
     }];
 }
 
+- (NSPersistentStoreCoordinator *)persistentStoreCoordinator
+{
+    NSManagedObjectContext *context = self.managedObjectContext;
+    while (context && ! [context persistentStoreCoordinator]) context = [context parentContext];
+    return [context persistentStoreCoordinator];
+}
+
+/*
+ Reads the associations of the given keys from the identity index into the shard, which must be locked for writing. Each key is read at most once: from then on the shard is authoritative for it, so a key that is changed, deleted or evicted is never resurrected from the index.
+ */
+- (void)faultCacheKeys:(NSArray *)cacheKeys fromIdentityIndex:(RKEntityIdentityIndex *)identityIndex intoShard:(RKEntityCacheShard *)shard
+{
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = nil;
+    NSUInteger objectIDCount = shard.objectIDCount;
+    for (RKEntityCacheKey *cacheKey in cacheKeys) {
+        if ([shard.faultedCacheKeys containsObject:cacheKey]) continue;
+        [shard.faultedCacheKeys addObject:cacheKey];
+
+        NSArray *objectIDURIStrings = [identityIndex objectIDURIStringsForKeyData:RKEntityIdentityIndexKeyDataForValues([cacheKey allValues])];
+        if ([objectIDURIStrings count] == 0) continue;
+        if (! persistentStoreCoordinator) persistentStoreCoordinator = [self persistentStoreCoordinator];
+        for (NSString *objectIDURIString in objectIDURIStrings) {
+            NSManagedObjectID *objectID = [persistentStoreCoordinator managedObjectIDForURIRepresentation:[NSURL URLWithString:objectIDURIString]];
+            if (objectID) [shard cacheObjectID:objectID forCacheKey:cacheKey];
+        }
+    }
+    [self addToObjectIDCount:(NSInteger)shard.objectIDCount - (NSInteger)objectIDCount];
+}
+
+- (BOOL)loadFromIdentityIndexAtPath:(NSString *)path metadata:(NSDictionary *)metadata
+{
+    NSParameterAssert(path);
+    NSError *error = nil;
+    RKEntityIdentityIndex *identityIndex = [[RKEntityIdentityIndex alloc] initWithContentsOfFile:path error:&error];
+    if (! identityIndex) {
+        RKLogDebug(@"Unable to open identity index at path '%@' for Entity '%@': %@", path, self.entity.name, [error localizedDescription]);
+        return NO;
+    }
+    if (! [identityIndex.metadata isEqualToDictionary:metadata ?: @{}]) {
+        RKLogDebug(@"Ignoring out of date identity index at path '%@' for Entity '%@': expected metadata %@, found %@", path, self.entity.name, metadata, identityIndex.metadata);
+        return NO;
+    }
+
+    RKLogDebug(@"Loading entity cache for Entity '%@' by attributes '%@' from identity index with %ld keys at path '%@'", self.entity.name, self.attributes, (long)identityIndex.count, path);
+    self.identityIndex = identityIndex;
+    if (! identityIndex.isComplete) {
+        for (RKEntityCacheShard *shard in self.shards) {
+            [shard lockForWriting];
+            shard.complete = NO;
+            [shard unlock];
+        }
+    }
+    self.loadFinished = YES;
+    return YES;
+}
+
+- (NSData *)identityIndexDataWithMetadata:(NSDictionary *)metadata
+{
+    __block BOOL complete = YES;
+    NSMutableDictionary *objectIDURIStringsByKeyData = [NSMutableDictionary dictionary];
+    NSMutableSet *faultedKeyData = [NSMutableSet set];
+    for (RKEntityCacheShard *shard in self.shards) {
+        [shard lockForReading];
+        if (! shard.isComplete) complete = NO;
+        [shard.cacheKeysToBuckets enumerateKeysAndObjectsUsingBlock:^(RKEntityCacheKey *cacheKey, RKEntityCacheBucket *bucket, BOOL *stop) {
+            NSSet *objectIDs = bucket.objectIDs;
+            NSData *keyData = RKEntityIdentityIndexKeyDataForValues([cacheKey allValues]);
+            if (! keyData) {
+                complete = NO;
+                return;
+            }
+            // Objects with temporary IDs have not been saved and do not belong in an index of the store
+            NSMutableArray *objectIDURIStrings = [NSMutableArray arrayWithCapacity:[objectIDs count]];
+            for (NSManagedObjectID *objectID in objectIDs) {
+                if (! [objectID isTemporaryID]) [objectIDURIStrings addObject:[[objectID URIRepresentation] absoluteString]];
+            }
+            if ([objectIDURIStrings count]) [objectIDURIStringsByKeyData setObject:objectIDURIStrings forKey:keyData];
+        }];
+        for (RKEntityCacheKey *cacheKey in shard.faultedCacheKeys) {
+            NSData *keyData = RKEntityIdentityIndexKeyDataForValues([cacheKey allValues]);
+            if (keyData) [faultedKeyData addObject:keyData];
+        }
+        [shard unlock];
+    }
+
+    // Keys that have not been faulted in are carried over from the index the cache was loaded from
+    RKEntityIdentityIndex *identityIndex = self.identityIndex;
+    if (identityIndex) {
+        if (! identityIndex.isComplete) complete = NO;
+        [identityIndex enumerateKeysAndObjectIDURIStringsUsingBlock:^(NSData *keyData, NSArray *objectIDURIStrings, BOOL *stop) {
+            if (! [faultedKeyData containsObject:keyData]) [objectIDURIStringsByKeyData setObject:objectIDURIStrings forKey:keyData];
+        }];
+    }
+
+    return [RKEntityIdentityIndex dataWithObjectIDURIStringsByKeyData:objectIDURIStringsByKeyData metadata:metadata complete:complete];
+}
+
 - (BOOL)containsObjectWithAttributeValues:(NSDictionary *)attributeValues
 {
     return [[self objectsWithAttributeValues:attributeValues inContext:self.managedObjectContext] count] > 0;
@@ -390,11 +1152,20 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 
 - (BOOL)containsObject:(NSManagedObject *)object
 {
-    __block NSArray *allObjectIDs = nil;
-    dispatch_sync(self.queue, ^{
-        allObjectIDs = [[self.cacheKeysToObjectIDs allValues] valueForKeyPath:@"@distinctUnionOfSets.self"];
-    });
-    return [allObjectIDs containsObject:object.objectID];
+    NSManagedObjectID *objectID = object.objectID;
+    for (RKEntityCacheShard *shard in self.shards) {
+        BOOL containsObject = NO;
+        [shard lockForReading];
+        for (RKEntityCacheBucket *bucket in [shard.cacheKeysToBuckets objectEnumerator]) {
+            if ([bucket.objectIDs containsObject:objectID]) {
+                containsObject = YES;
+                break;
+            }
+        }
+        [shard unlock];
+        if (containsObject) return YES;
+    }
+    return NO;
 }
 
 - (void)didReceiveMemoryWarning:(NSNotification *)notification
@@ -55,6 +55,42 @@
  */
 @property (nonatomic, assign) dispatch_queue_t callbackQueue;
 
+///----------------------------
+/// @name Bounding Cache Memory
+///----------------------------
+
+/**
+ The maximum number of managed object ID's retained by the receiver, or zero if the receiver is unbounded. The limit is divided evenly between the entity attribute caches of the receiver, which evict the least recently used attribute values when they exceed their share and reload evicted values on demand with a targeted fetch.
+
+ **Default**: `0`
+ @see `[RKEntityByAttributeCache maximumObjectIDCount]`
+ */
+@property (nonatomic, assign) NSUInteger maximumObjectIDCount;
+
+///----------------------------------
+/// @name Inspecting Cache Statistics
+///----------------------------------
+
+/**
+ The number of attribute values looked up by the receiver that were found in its entity attribute caches.
+ */
+@property (nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of attribute values looked up by the receiver that were not found in its entity attribute caches.
+ */
+@property (nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The number of attribute values evicted from the entity attribute caches of the receiver to remain within `maximumObjectIDCount`.
+ */
+@property (nonatomic, readonly) NSUInteger evictionCount;
+
+/**
+ Resets the hit, miss and eviction counts of all entity attribute caches of the receiver to zero.
+ */
+- (void)resetStatistics;
+
 ///------------------------------------
 /// @name Caching Objects by Attributes
 ///------------------------------------
@@ -67,6 +103,18 @@
  */
 - (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames completion:(void (^)(void))completion;
 
+/**
+ Caches all instances of an entity using the values for attributes as the cache key, loading the cache from an identity index if one with the given metadata exists at the given path rather than fetching the instances from the persistent store.
+
+ @param entity The entity to cache all instances of.
+ @param attributeNames The attributes to cache the instances by.
+ @param identityIndexPath The path of an identity index file, or `nil` to always load the cache from the persistent store.
+ @param metadata The metadata the identity index must have been written with.
+ @param completion An optional block to be executed when the cache has been loaded.
+ @see [RKEntityByAttributeCache loadFromIdentityIndexAtPath:metadata:]
+ */
+- (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames identityIndexPath:(NSString *)identityIndexPath metadata:(NSDictionary *)metadata completion:(void (^)(void))completion;
+
 /**
  Returns a Boolean value indicating if all instances of an entity have been cached by a given attribute name.
 
@@ -147,6 +195,15 @@
  */
 - (void)removeObjects:(NSSet *)objects completion:(void (^)(void))completion;
 
+/**
+ Moves the given set of updated objects between attribute values in all entity attribute caches for the object's entity contained within the receiver. Objects whose cached attributes have not changed are skipped.
+
+ @param objects The set of updated objects.
+ @param completion An optional block to be executed when the caches have been updated.
+ @see [RKEntityByAttributeCache updateObjects:completion:]
+ */
+- (void)updateObjects:(NSSet *)objects completion:(void (^)(void))completion;
+
 /**
  Returns a Boolean value that indicates if the receiver contains the given object in any of its attribute caches.
  
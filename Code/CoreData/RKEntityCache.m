@@ -45,20 +45,66 @@
 }
 
 - (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames completion:(void (^)(void))completion
+{
+    [self cacheObjectsForEntity:entity byAttributes:attributeNames identityIndexPath:nil metadata:nil completion:completion];
+}
+
+- (void)cacheObjectsForEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames identityIndexPath:(NSString *)identityIndexPath metadata:(NSDictionary *)metadata completion:(void (^)(void))completion
 {
     NSParameterAssert(entity);
     NSParameterAssert(attributeNames);
     RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:attributeNames];
-    if (attributeCache && !attributeCache.isLoaded) {
-        [attributeCache load:completion];
-    } else {
+    if (! (attributeCache && !attributeCache.isLoaded)) {
         attributeCache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:attributeNames managedObjectContext:self.managedObjectContext];
         attributeCache.callbackQueue = self.callbackQueue;
-        [attributeCache load:completion];
         [self.attributeCaches addObject:attributeCache];
+        [self distributeMaximumObjectIDCount];
+    }
+
+    if (identityIndexPath && [attributeCache loadFromIdentityIndexAtPath:identityIndexPath metadata:metadata]) {
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+    } else {
+        [attributeCache load:completion];
+    }
+}
+
+- (void)setMaximumObjectIDCount:(NSUInteger)maximumObjectIDCount
+{
+    _maximumObjectIDCount = maximumObjectIDCount;
+    [self distributeMaximumObjectIDCount];
+}
+
+// Divides the budget evenly between the attribute caches, as each retains its own associations to object IDs
+- (void)distributeMaximumObjectIDCount
+{
+    NSSet *attributeCaches = [self.attributeCaches copy];
+    if ([attributeCaches count] == 0) return;
+    NSUInteger maximumObjectIDCount = self.maximumObjectIDCount ? MAX(self.maximumObjectIDCount / [attributeCaches count], 1) : 0;
+    for (RKEntityByAttributeCache *attributeCache in attributeCaches) {
+        attributeCache.maximumObjectIDCount = maximumObjectIDCount;
     }
 }
 
+- (NSUInteger)hitCount
+{
+    return [[[self.attributeCaches copy] valueForKeyPath:@"@sum.hitCount"] unsignedIntegerValue];
+}
+
+- (NSUInteger)missCount
+{
+    return [[[self.attributeCaches copy] valueForKeyPath:@"@sum.missCount"] unsignedIntegerValue];
+}
+
+- (NSUInteger)evictionCount
+{
+    return [[[self.attributeCaches copy] valueForKeyPath:@"@sum.evictionCount"] unsignedIntegerValue];
+}
+
+- (void)resetStatistics
+{
+    [[self.attributeCaches copy] makeObjectsPerformSelector:@selector(resetStatistics)];
+}
+
 - (BOOL)isEntity:(NSEntityDescription *)entity cachedByAttributes:(NSArray *)attributeNames
 {
     NSParameterAssert(entity);
@@ -98,7 +144,8 @@
     NSParameterAssert(entity);
     NSParameterAssert(attributeNames);
     for (RKEntityByAttributeCache *cache in [self.attributeCaches copy]) {
-        if ([cache.entity isEqual:entity] && [cache.attributes isEqualToArray:attributeNames]) {
+        // The order of the attributes is not significant, as lookups name them by the keys of a dictionary
+        if ([cache.entity isEqual:entity] && [cache.attributes count] == [attributeNames count] && [[NSSet setWithArray:cache.attributes] isEqualToSet:[NSSet setWithArray:attributeNames]]) {
             return cache;
         }
     }
@@ -218,6 +265,28 @@
     if (dispatchGroup) [self waitForDispatchGroup:dispatchGroup withCompletionBlock:completion];
 }
 
+- (void)updateObjects:(NSSet *)objects completion:(void (^)(void))completion
+{
+    dispatch_group_t dispatchGroup = completion ? dispatch_group_create() : NULL;
+    NSSet *distinctEntities = [objects valueForKeyPath:@"entity"];
+    for (NSEntityDescription *entity in distinctEntities) {
+        NSArray *attributeCaches = [self attributeCachesForEntity:entity];
+        if ([attributeCaches count]) {
+            NSMutableSet *objectsToUpdate = [NSMutableSet set];
+            for (NSManagedObject *managedObject in objects) {
+                if ([managedObject.entity isEqual:entity]) [objectsToUpdate addObject:managedObject];
+            }
+            for (RKEntityByAttributeCache *cache in attributeCaches) {
+                if (dispatchGroup) dispatch_group_enter(dispatchGroup);
+                [cache updateObjects:objectsToUpdate completion:^{
+                    if (dispatchGroup) dispatch_group_leave(dispatchGroup);
+                }];
+            }
+        }
+    }
+    if (dispatchGroup) [self waitForDispatchGroup:dispatchGroup withCompletionBlock:completion];
+}
+
 - (BOOL)containsObject:(NSManagedObject *)managedObject
 {
     for (RKEntityByAttributeCache *attributeCache in [self attributeCachesForEntity:managedObject.entity]) {
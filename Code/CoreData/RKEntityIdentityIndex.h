@@ -0,0 +1,114 @@
+//
+//  RKEntityIdentityIndex.h
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ Returns a compact, stable binary encoding of an array of attribute values for use as a key of an `RKEntityIdentityIndex`. Values that compare equal with `isEqual:`, such as an integral `NSNumber` of any type, have the same encoding.
+
+ Values may be instances of `NSString`, `NSNumber`, `NSDate`, `NSData` or `NSNull`.
+
+ @param values An array of attribute values.
+ @return The encoding of the attribute values, or `nil` if one or more of the values cannot be encoded.
+ */
+NSData *RKEntityIdentityIndexKeyDataForValues(NSArray *values);
+
+/**
+ The `RKEntityIdentityIndex` class provides read access to an on-disk index of managed object ID URI representations by attribute values, which `RKEntityByAttributeCache` uses to avoid loading its associations from the persistent store on launch.
+
+ The index is an open addressing hash table that is memory mapped rather than read into memory, so opening an index costs the same regardless of its size and each lookup only touches the pages of the entries it probes. Index files are created with `dataWithObjectIDURIStringsByKeyData:metadata:complete:` and are immutable: an index that has gone out of date is replaced by writing a new file.
+
+ ## Validating an Index
+
+ Each index carries an arbitrary property list dictionary of metadata that is supplied when it is written. Consumers of an index are expected to record enough details about the persistent store and the entity in the metadata, and to compare them to the current values before using the index.
+ */
+@interface RKEntityIdentityIndex : NSObject
+
+///-----------------------
+/// @name Opening an Index
+///-----------------------
+
+/**
+ Initializes the receiver by memory mapping the index file at the given path.
+
+ @param path The path of the index file.
+ @param error A pointer to an error object that is set if the file could not be read or is not a valid index.
+ @return The receiver, initialized with the contents of the file, or `nil` if the file could not be opened.
+ */
+- (id)initWithContentsOfFile:(NSString *)path error:(NSError **)error;
+
+/**
+ Initializes the receiver with the contents of an index file.
+
+ @param data The contents of an index file, as returned by `dataWithObjectIDURIStringsByKeyData:metadata:complete:`.
+ @param error A pointer to an error object that is set if the data is not a valid index.
+ @return The receiver, initialized with the given data, or `nil` if the data is not a valid index.
+ */
+- (id)initWithData:(NSData *)data error:(NSError **)error;
+
+///--------------------------
+/// @name Inspecting an Index
+///--------------------------
+
+/**
+ The metadata the index was written with.
+ */
+@property (nonatomic, copy, readonly) NSDictionary *metadata;
+
+/**
+ A Boolean value indicating if the index contains every association of the cache it was written from. A lookup that misses a complete index is conclusive.
+ */
+@property (nonatomic, assign, readonly, getter = isComplete) BOOL complete;
+
+/**
+ The number of keys in the index.
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ Returns the managed object ID URI representations indexed by the given key.
+
+ @param keyData A key, as returned by `RKEntityIdentityIndexKeyDataForValues`.
+ @return An array of URI strings, or `nil` if the key is not in the index.
+ */
+- (NSArray *)objectIDURIStringsForKeyData:(NSData *)keyData;
+
+/**
+ Enumerates all keys of the index with the managed object ID URI representations indexed by them.
+
+ @param block A block invoked with each key and its array of URI strings.
+ */
+- (void)enumerateKeysAndObjectIDURIStringsUsingBlock:(void (^)(NSData *keyData, NSArray *objectIDURIStrings, BOOL *stop))block;
+
+///-----------------------
+/// @name Writing an Index
+///-----------------------
+
+/**
+ Returns the contents of an index file for the given associations.
+
+ @param objectIDURIStringsByKeyData A dictionary whose keys are encoded attribute values and whose values are arrays of managed object ID URI strings.
+ @param metadata A property list dictionary to store with the index.
+ @param complete A Boolean value indicating if the associations are every association of the cache the index is written from.
+ @return The contents of an index file.
+ */
++ (NSData *)dataWithObjectIDURIStringsByKeyData:(NSDictionary *)objectIDURIStringsByKeyData metadata:(NSDictionary *)metadata complete:(BOOL)complete;
+
+@end
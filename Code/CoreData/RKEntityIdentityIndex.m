@@ -0,0 +1,319 @@
+//
+//  RKEntityIdentityIndex.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKEntityIdentityIndex.h"
+
+/*
+ Layout of an index file, in host byte order:
+
+    header      RKEntityIdentityIndexHeader
+    metadata    binary property list of `metadataLength` bytes
+    prefix      UTF-8 URI prefix of `prefixLength` bytes shared by the object ID URIs
+    slots       `slotCount` RKEntityIdentityIndexSlot, where `slotCount` is a power of two
+    records     one record per key: uint32 key length, key bytes, uint32 URI count, then for each URI a uint8 that is 1
+                if the URI is stored relative to the prefix, a uint32 length and the UTF-8 bytes
+
+ A slot holds the hash of a key and the offset of its record from the start of the records plus one, with zero marking an empty slot. Collisions are resolved by linear probing. Nothing in the file is aligned, so all multibyte fields are read with `memcpy`.
+ */
+static uint32_t const RKEntityIdentityIndexMagic = 'RKII';
+static uint32_t const RKEntityIdentityIndexVersion = 1;
+static uint32_t const RKEntityIdentityIndexCompleteFlag = 1 << 0;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t metadataLength;
+    uint32_t prefixLength;
+    uint32_t slotCount;
+    uint32_t keyCount;
+} RKEntityIdentityIndexHeader;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t recordOffset;
+} RKEntityIdentityIndexSlot;
+
+// 32-bit FNV-1a, which unlike `-[NSObject hash]` is stable across processes and releases of the OS
+static uint32_t RKEntityIdentityIndexHash(const uint8_t *bytes, NSUInteger length)
+{
+    uint32_t hash = 2166136261U;
+    for (NSUInteger i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static void RKAppendUInt32(NSMutableData *data, uint32_t value)
+{
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void RKAppendLengthPrefixedString(NSMutableData *data, NSString *string)
+{
+    NSData *stringData = [string dataUsingEncoding:NSUTF8StringEncoding];
+    RKAppendUInt32(data, (uint32_t)[stringData length]);
+    [data appendData:stringData];
+}
+
+NSData *RKEntityIdentityIndexKeyDataForValues(NSArray *values)
+{
+    NSMutableData *keyData = [NSMutableData data];
+    for (id value in values) {
+        if (value == [NSNull null]) {
+            [keyData appendBytes:"n" length:1];
+        } else if ([value isKindOfClass:[NSString class]]) {
+            [keyData appendBytes:"s" length:1];
+            RKAppendLengthPrefixedString(keyData, value);
+        } else if ([value isKindOfClass:[NSNumber class]]) {
+            // Integral values are encoded as integers regardless of their type, as `@1` and `@1.0` are equal
+            double doubleValue = [value doubleValue];
+            if (CFNumberIsFloatType((__bridge CFNumberRef)value) && (doubleValue != floor(doubleValue) || fabs(doubleValue) >= 9.2e18)) {
+                [keyData appendBytes:"d" length:1];
+                [keyData appendBytes:&doubleValue length:sizeof(doubleValue)];
+            } else {
+                long long integerValue = CFNumberIsFloatType((__bridge CFNumberRef)value) ? (long long)doubleValue : [value longLongValue];
+                [keyData appendBytes:"i" length:1];
+                [keyData appendBytes:&integerValue length:sizeof(integerValue)];
+            }
+        } else if ([value isKindOfClass:[NSDate class]]) {
+            NSTimeInterval timeInterval = [value timeIntervalSinceReferenceDate];
+            [keyData appendBytes:"t" length:1];
+            [keyData appendBytes:&timeInterval length:sizeof(timeInterval)];
+        } else if ([value isKindOfClass:[NSData class]]) {
+            [keyData appendBytes:"b" length:1];
+            RKAppendUInt32(keyData, (uint32_t)[value length]);
+            [keyData appendData:value];
+        } else {
+            return nil;
+        }
+    }
+    return keyData;
+}
+
+static NSError *RKEntityIdentityIndexCorruptFileError(NSString *reason)
+{
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{ NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The identity index is not valid: %@", reason] }];
+}
+
+@interface RKEntityIdentityIndex ()
+@property (nonatomic, strong) NSData *data;
+@property (nonatomic, copy, readwrite) NSDictionary *metadata;
+@property (nonatomic, assign, readwrite, getter = isComplete) BOOL complete;
+@property (nonatomic, assign, readwrite) NSUInteger count;
+@property (nonatomic, copy) NSString *objectIDURIPrefix;
+@property (nonatomic, assign) NSUInteger slotCount;
+@property (nonatomic, assign) NSUInteger slotsOffset;
+@property (nonatomic, assign) NSUInteger recordsOffset;
+@end
+
+@implementation RKEntityIdentityIndex
+
+- (id)initWithContentsOfFile:(NSString *)path error:(NSError **)error
+{
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+    if (! data) return nil;
+    return [self initWithData:data error:error];
+}
+
+- (id)initWithData:(NSData *)data error:(NSError **)error
+{
+    NSParameterAssert(data);
+    self = [super init];
+    if (self) {
+        RKEntityIdentityIndexHeader header;
+        if ([data length] < sizeof(header)) {
+            if (error) *error = RKEntityIdentityIndexCorruptFileError(@"the file is truncated");
+            return nil;
+        }
+        [data getBytes:&header length:sizeof(header)];
+        if (header.magic != RKEntityIdentityIndexMagic || header.version != RKEntityIdentityIndexVersion) {
+            if (error) *error = RKEntityIdentityIndexCorruptFileError(@"the file format is not supported");
+            return nil;
+        }
+
+        NSUInteger metadataOffset = sizeof(header);
+        NSUInteger prefixOffset = metadataOffset + header.metadataLength;
+        NSUInteger slotsOffset = prefixOffset + header.prefixLength;
+        NSUInteger recordsOffset = slotsOffset + (NSUInteger)header.slotCount * sizeof(RKEntityIdentityIndexSlot);
+        if (header.slotCount == 0 || (header.slotCount & (header.slotCount - 1)) || recordsOffset > [data length]) {
+            if (error) *error = RKEntityIdentityIndexCorruptFileError(@"the file is truncated");
+            return nil;
+        }
+
+        NSDictionary *metadata = [NSPropertyListSerialization propertyListWithData:[data subdataWithRange:NSMakeRange(metadataOffset, header.metadataLength)] options:NSPropertyListImmutable format:NULL error:error];
+        if (! [metadata isKindOfClass:[NSDictionary class]]) {
+            if (error && metadata) *error = RKEntityIdentityIndexCorruptFileError(@"the metadata is not a dictionary");
+            return nil;
+        }
+
+        self.data = data;
+        self.metadata = metadata;
+        self.complete = (header.flags & RKEntityIdentityIndexCompleteFlag) != 0;
+        self.count = header.keyCount;
+        self.objectIDURIPrefix = [[NSString alloc] initWithData:[data subdataWithRange:NSMakeRange(prefixOffset, header.prefixLength)] encoding:NSUTF8StringEncoding];
+        self.slotCount = header.slotCount;
+        self.slotsOffset = slotsOffset;
+        self.recordsOffset = recordsOffset;
+    }
+
+    return self;
+}
+
+/*
+ Reads the record at the given offset from the start of the records. The key of the record is returned by reference and its URIs are returned if requested. Returns `NO` if the record extends beyond the end of the file.
+ */
+- (BOOL)readRecordAtOffset:(NSUInteger)offset keyBytes:(const uint8_t **)keyBytes keyLength:(uint32_t *)keyLength objectIDURIStrings:(NSArray **)objectIDURIStrings
+{
+    const uint8_t *bytes = [self.data bytes];
+    NSUInteger length = [self.data length];
+    NSUInteger position = self.recordsOffset + offset;
+
+    if (position + sizeof(uint32_t) > length) return NO;
+    memcpy(keyLength, bytes + position, sizeof(uint32_t));
+    position += sizeof(uint32_t);
+    if (position + *keyLength + sizeof(uint32_t) > length) return NO;
+    *keyBytes = bytes + position;
+    position += *keyLength;
+    if (! objectIDURIStrings) return YES;
+
+    uint32_t objectIDURICount;
+    memcpy(&objectIDURICount, bytes + position, sizeof(uint32_t));
+    position += sizeof(uint32_t);
+    NSMutableArray *strings = [NSMutableArray arrayWithCapacity:objectIDURICount];
+    for (uint32_t i = 0; i < objectIDURICount; i++) {
+        if (position + 1 + sizeof(uint32_t) > length) return NO;
+        BOOL isRelative = bytes[position] == 1;
+        uint32_t stringLength;
+        memcpy(&stringLength, bytes + position + 1, sizeof(uint32_t));
+        position += 1 + sizeof(uint32_t);
+        if (position + stringLength > length) return NO;
+        NSString *string = [[NSString alloc] initWithBytes:bytes + position length:stringLength encoding:NSUTF8StringEncoding];
+        position += stringLength;
+        if (! string) continue;
+        [strings addObject:isRelative ? [self.objectIDURIPrefix stringByAppendingString:string] : string];
+    }
+    *objectIDURIStrings = strings;
+    return YES;
+}
+
+- (NSArray *)objectIDURIStringsForKeyData:(NSData *)keyData
+{
+    if (! keyData) return nil;
+    uint32_t hash = RKEntityIdentityIndexHash([keyData bytes], [keyData length]);
+    const RKEntityIdentityIndexSlot *slots = (const RKEntityIdentityIndexSlot *)((const uint8_t *)[self.data bytes] + self.slotsOffset);
+    NSUInteger mask = self.slotCount - 1;
+    for (NSUInteger probe = 0, index = hash & mask; probe < self.slotCount; probe++, index = (index + 1) & mask) {
+        RKEntityIdentityIndexSlot slot;
+        memcpy(&slot, &slots[index], sizeof(slot));
+        if (slot.recordOffset == 0) return nil;
+        if (slot.hash != hash) continue;
+
+        const uint8_t *keyBytes;
+        uint32_t keyLength;
+        if (! [self readRecordAtOffset:slot.recordOffset - 1 keyBytes:&keyBytes keyLength:&keyLength objectIDURIStrings:NULL]) return nil;
+        if (keyLength != [keyData length] || memcmp(keyBytes, [keyData bytes], keyLength) != 0) continue;
+
+        NSArray *objectIDURIStrings = nil;
+        [self readRecordAtOffset:slot.recordOffset - 1 keyBytes:&keyBytes keyLength:&keyLength objectIDURIStrings:&objectIDURIStrings];
+        return objectIDURIStrings;
+    }
+    return nil;
+}
+
+- (void)enumerateKeysAndObjectIDURIStringsUsingBlock:(void (^)(NSData *keyData, NSArray *objectIDURIStrings, BOOL *stop))block
+{
+    const RKEntityIdentityIndexSlot *slots = (const RKEntityIdentityIndexSlot *)((const uint8_t *)[self.data bytes] + self.slotsOffset);
+    BOOL stop = NO;
+    for (NSUInteger index = 0; index < self.slotCount && !stop; index++) {
+        RKEntityIdentityIndexSlot slot;
+        memcpy(&slot, &slots[index], sizeof(slot));
+        if (slot.recordOffset == 0) continue;
+
+        @autoreleasepool {
+            const uint8_t *keyBytes;
+            uint32_t keyLength;
+            NSArray *objectIDURIStrings = nil;
+            if (! [self readRecordAtOffset:slot.recordOffset - 1 keyBytes:&keyBytes keyLength:&keyLength objectIDURIStrings:&objectIDURIStrings]) continue;
+            block([NSData dataWithBytes:keyBytes length:keyLength], objectIDURIStrings, &stop);
+        }
+    }
+}
+
++ (NSData *)dataWithObjectIDURIStringsByKeyData:(NSDictionary *)objectIDURIStringsByKeyData metadata:(NSDictionary *)metadata complete:(BOOL)complete
+{
+    NSParameterAssert(objectIDURIStringsByKeyData);
+    NSData *metadataData = [NSPropertyListSerialization dataWithPropertyList:metadata ?: @{} format:NSPropertyListBinaryFormat_v1_0 options:0 error:nil];
+    NSAssert(metadataData, @"The metadata of an identity index must be a property list");
+
+    // URIs of the form `x-coredata://<store UUID>/<entity>/p<primary key>` are stored relative to the prefix of the first one
+    NSString *objectIDURIString = [[[objectIDURIStringsByKeyData objectEnumerator] nextObject] lastObject];
+    NSRange lastSeparatorRange = objectIDURIString ? [objectIDURIString rangeOfString:@"/" options:NSBackwardsSearch] : NSMakeRange(NSNotFound, 0);
+    NSString *prefix = (lastSeparatorRange.location != NSNotFound) ? [objectIDURIString substringToIndex:NSMaxRange(lastSeparatorRange)] : @"";
+    NSData *prefixData = [prefix dataUsingEncoding:NSUTF8StringEncoding];
+
+    uint32_t slotCount = 2;
+    while (slotCount < [objectIDURIStringsByKeyData count] * 2) slotCount <<= 1;
+    NSMutableData *slotsData = [NSMutableData dataWithLength:slotCount * sizeof(RKEntityIdentityIndexSlot)];
+    RKEntityIdentityIndexSlot *slots = [slotsData mutableBytes];
+    NSMutableData *recordsData = [NSMutableData data];
+
+    [objectIDURIStringsByKeyData enumerateKeysAndObjectsUsingBlock:^(NSData *keyData, NSArray *objectIDURIStrings, BOOL *stop) {
+        uint32_t hash = RKEntityIdentityIndexHash([keyData bytes], [keyData length]);
+        uint32_t index = hash & (slotCount - 1);
+        while (slots[index].recordOffset != 0) index = (index + 1) & (slotCount - 1);
+        slots[index].hash = hash;
+        slots[index].recordOffset = (uint32_t)[recordsData length] + 1;
+
+        RKAppendUInt32(recordsData, (uint32_t)[keyData length]);
+        [recordsData appendData:keyData];
+        RKAppendUInt32(recordsData, (uint32_t)[objectIDURIStrings count]);
+        for (NSString *string in objectIDURIStrings) {
+            BOOL isRelative = [prefix length] && [string hasPrefix:prefix];
+            uint8_t flag = isRelative ? 1 : 0;
+            [recordsData appendBytes:&flag length:1];
+            RKAppendLengthPrefixedString(recordsData, isRelative ? [string substringFromIndex:[prefix length]] : string);
+        }
+    }];
+
+    RKEntityIdentityIndexHeader header = {
+        .magic = RKEntityIdentityIndexMagic,
+        .version = RKEntityIdentityIndexVersion,
+        .flags = complete ? RKEntityIdentityIndexCompleteFlag : 0,
+        .metadataLength = (uint32_t)[metadataData length],
+        .prefixLength = (uint32_t)[prefixData length],
+        .slotCount = slotCount,
+        .keyCount = (uint32_t)[objectIDURIStringsByKeyData count]
+    };
+    NSMutableData *data = [NSMutableData dataWithBytes:&header length:sizeof(header)];
+    [data appendData:metadataData];
+    [data appendData:prefixData];
+    [data appendData:slotsData];
+    [data appendData:recordsData];
+    return data;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p count=%ld complete=%@ metadata=%@>", NSStringFromClass([self class]), self, (long)self.count, self.isComplete ? @"YES" : @"NO", self.metadata];
+}
+
+@end
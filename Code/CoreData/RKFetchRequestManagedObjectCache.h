@@ -25,7 +25,20 @@
  is satisfied by dispatching an NSFetchRequest against the Core Data persistent store.
  Performance can be disappointing for data sets with a large amount of redundant data
  being mapped and connected together, but the memory footprint stays flat.
+
+ Fetch requests are prepared once for each entity and shape of identification attributes
+ and reused for every subsequent lookup. Prepared requests fetch the property values of
+ the identified objects rather than returning them as faults, and fetch at most one object
+ when the identification attributes cover a uniqueness constraint of the entity.
  */
 @interface RKFetchRequestManagedObjectCache : NSObject <RKManagedObjectCaching>
 
+/**
+ The number of fetch requests the receiver has executed against a managed object context.
+
+ Comparing the fetch count before and after a mapping operation reveals how many round trips
+ to the persistent store the operation incurred for identifying managed objects.
+ */
+@property (nonatomic, readonly) NSUInteger fetchCount;
+
 @end
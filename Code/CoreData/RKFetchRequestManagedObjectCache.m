@@ -43,28 +43,123 @@ static NSString *RKPredicateCacheKeyForAttributeValues(NSDictionary *attributesV
     return [keyFragments componentsJoinedByString:@":"];
 }
 
-// NOTE: We build a dynamic format string here because `NSCompoundPredicate` does not support use of substiution variables
-static NSPredicate *RKPredicateWithSubsitutionVariablesForAttributeValues(NSDictionary *attributeValues)
+/*
+ Returns a Boolean value that indicates if at most one instance of the entity can match a given value for each of the attributes, which is the case when the attributes include all attributes of one of the uniqueness constraints of the entity. Uniqueness constraints are only available from iOS 9 and OS X 10.11.
+ */
+static BOOL RKAttributesIdentifyUniqueInstanceOfEntity(NSArray *attributeNames, NSEntityDescription *entity)
 {
-    NSArray *attributeNames = [attributeValues allKeys];
-    NSMutableArray *formatFragments = [NSMutableArray arrayWithCapacity:[attributeNames count]];
-    [attributeValues enumerateKeysAndObjectsUsingBlock:^(NSString *attributeName, id value, BOOL *stop) {
-        NSString *formatFragment = RKObjectIsCollection(value)
-                                 ? [NSString stringWithFormat:@"%@ IN $%@", attributeName, attributeName]
-                                 : [NSString stringWithFormat:@"%@ = $%@", attributeName, attributeName];
-        [formatFragments addObject:formatFragment];
-    }];
+    if (! [entity respondsToSelector:NSSelectorFromString(@"uniquenessConstraints")]) return NO;
+    NSSet *attributeNameSet = [NSSet setWithArray:attributeNames];
+    for (NSArray *uniquenessConstraint in [entity valueForKey:@"uniquenessConstraints"]) {
+        NSMutableSet *constraintAttributeNames = [NSMutableSet setWithCapacity:[uniquenessConstraint count]];
+        for (id attribute in uniquenessConstraint) {
+            [constraintAttributeNames addObject:[attribute isKindOfClass:[NSString class]] ? attribute : [attribute name]];
+        }
+        if ([constraintAttributeNames count] && [constraintAttributeNames isSubsetOfSet:attributeNameSet]) return YES;
+    }
+    return NO;
+}
+
+/**
+ An immutable, fully prepared fetch request for identifying instances of an entity by a particular shape of attribute values: the same attribute names, each with either a singular or a collection value. Lookups copy the prepared request and attach a predicate built directly from comparison predicates, rather than substituting variables into a parsed predicate.
+ */
+@interface RKFetchRequestTemplate : NSObject
+@property (nonatomic, strong, readonly) NSFetchRequest *fetchRequest;
+@property (nonatomic, copy, readonly) NSArray *attributeNames;
+@property (nonatomic, copy, readonly) NSArray *leftExpressions;
+@property (nonatomic, copy, readonly) NSArray *operatorTypes;
+
+- (id)initWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues;
+- (NSFetchRequest *)fetchRequestWithAttributeValues:(NSDictionary *)attributeValues;
+@end
 
-    return [NSPredicate predicateWithFormat:[formatFragments componentsJoinedByString:@" AND "]];
+@implementation RKFetchRequestTemplate
+
+- (id)initWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    self = [super init];
+    if (self) {
+        _attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+        NSMutableArray *leftExpressions = [NSMutableArray arrayWithCapacity:[_attributeNames count]];
+        NSMutableArray *operatorTypes = [NSMutableArray arrayWithCapacity:[_attributeNames count]];
+        BOOL containsCollection = NO;
+        for (NSString *attributeName in _attributeNames) {
+            BOOL isCollection = RKObjectIsCollection([attributeValues objectForKey:attributeName]);
+            containsCollection = containsCollection || isCollection;
+            [leftExpressions addObject:[NSExpression expressionForKeyPath:attributeName]];
+            [operatorTypes addObject:@(isCollection ? NSInPredicateOperatorType : NSEqualToPredicateOperatorType)];
+        }
+        _leftExpressions = leftExpressions;
+        _operatorTypes = operatorTypes;
+
+        // The identified objects are mapped onto immediately, so their property values are fetched with them rather than faulted in one at a time
+        NSFetchRequest *fetchRequest = [NSFetchRequest new];
+        fetchRequest.entity = entity;
+        fetchRequest.returnsObjectsAsFaults = NO;
+        fetchRequest.includesPropertyValues = YES;
+        if (! containsCollection && RKAttributesIdentifyUniqueInstanceOfEntity(_attributeNames, entity)) fetchRequest.fetchLimit = 1;
+        _fetchRequest = fetchRequest;
+    }
+
+    return self;
+}
+
+- (NSFetchRequest *)fetchRequestWithAttributeValues:(NSDictionary *)attributeValues
+{
+    NSUInteger count = [self.attributeNames count];
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        id value = [attributeValues objectForKey:[self.attributeNames objectAtIndex:i]];
+        NSExpression *rightExpression = [NSExpression expressionForConstantValue:(value == [NSNull null]) ? nil : value];
+        [subpredicates addObject:[NSComparisonPredicate predicateWithLeftExpression:[self.leftExpressions objectAtIndex:i]
+                                                                    rightExpression:rightExpression
+                                                                           modifier:NSDirectPredicateModifier
+                                                                               type:[[self.operatorTypes objectAtIndex:i] unsignedIntegerValue]
+                                                                            options:0]];
+    }
+
+    NSFetchRequest *fetchRequest = [self.fetchRequest copy];
+    fetchRequest.predicate = (count == 1) ? [subpredicates lastObject] : [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+    return fetchRequest;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p entity=%@ attributeNames=%@ fetchLimit=%ld>", NSStringFromClass([self class]), self, self.fetchRequest.entity.name, self.attributeNames, (long)self.fetchRequest.fetchLimit];
+}
+
+@end
+
+// The number of attribute value dictionaries identified by a single fetch request, which keeps the `IN` predicates within the host parameter limit of SQLite
+static NSUInteger const RKFetchRequestManagedObjectCacheBatchSize = 250;
+
+/*
+ Returns a predicate matching any object whose attribute values are among those of the given dictionaries. The predicate may match combinations of values that were not requested when there is more than one attribute, so the results must be matched against the dictionaries in memory.
+ */
+static NSPredicate *RKPredicateForAttributeValuesCollection(NSArray *attributeNames, NSArray *attributeValuesCollection)
+{
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        NSMutableSet *values = [NSMutableSet setWithArray:[attributeValuesCollection valueForKey:attributeName]];
+        BOOL matchesNil = [values containsObject:[NSNull null]];
+        [values removeObject:[NSNull null]];
+        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values];
+        if (matchesNil) {
+            predicate = [NSCompoundPredicate orPredicateWithSubpredicates:@[ predicate, [NSPredicate predicateWithFormat:@"%K == nil", attributeName] ]];
+        }
+        [subpredicates addObject:predicate];
+    }
+    return [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
 }
 
 @interface RKFetchRequestManagedObjectCache ()
-@property (nonatomic, strong) NSMutableDictionary *predicateCache;
 #if OS_OBJECT_USE_OBJC
-@property (nonatomic, strong) dispatch_queue_t cacheQueue;
+@property (nonatomic, strong) dispatch_queue_t queue;
 #else
-@property (nonatomic, assign) dispatch_queue_t cacheQueue;
+@property (nonatomic, assign) dispatch_queue_t queue;
 #endif
+@property (atomic, copy) NSDictionary *fetchRequestTemplates;
+@property (nonatomic, assign, readwrite) NSUInteger fetchCount;
 @end
 
 @implementation RKFetchRequestManagedObjectCache
@@ -73,8 +168,9 @@ static NSPredicate *RKPredicateWithSubsitutionVariablesForAttributeValues(NSDict
 {
     self = [super init];
     if (self) {
-        self.predicateCache = [NSMutableDictionary dictionary];
-        self.cacheQueue = dispatch_queue_create("org.restkit.core-data.fetch-request-cache-queue", DISPATCH_QUEUE_CONCURRENT);
+        // NOTE: The templates are an immutable dictionary that is copied and swapped on write so that lookups never wait on the queue
+        self.fetchRequestTemplates = [NSDictionary dictionary];
+        self.queue = dispatch_queue_create("org.restkit.core-data.fetch-request-cache-queue", DISPATCH_QUEUE_SERIAL);
     }
     return self;
 }
@@ -82,9 +178,46 @@ static NSPredicate *RKPredicateWithSubsitutionVariablesForAttributeValues(NSDict
 - (void)dealloc
 {
 #if !OS_OBJECT_USE_OBJC
-    if (_cacheQueue) dispatch_release(_cacheQueue);
+    if (_queue) dispatch_release(_queue);
 #endif
-    _cacheQueue = NULL;
+    _queue = NULL;
+}
+
+// A template is prepared the first time a shape of attribute values is seen for an entity and reused thereafter
+- (RKFetchRequestTemplate *)fetchRequestTemplateForEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    NSString *templateKey = [[entity name] stringByAppendingFormat:@"|%@", RKPredicateCacheKeyForAttributeValues(attributeValues)];
+    __block RKFetchRequestTemplate *fetchRequestTemplate = [self.fetchRequestTemplates objectForKey:templateKey];
+    if (fetchRequestTemplate) return fetchRequestTemplate;
+
+    fetchRequestTemplate = [[RKFetchRequestTemplate alloc] initWithEntity:entity attributeValues:attributeValues];
+    dispatch_sync(self.queue, ^{
+        // Another thread may have published a template for the key since the lookup
+        RKFetchRequestTemplate *publishedTemplate = [self.fetchRequestTemplates objectForKey:templateKey];
+        if (publishedTemplate) {
+            fetchRequestTemplate = publishedTemplate;
+            return;
+        }
+        NSMutableDictionary *fetchRequestTemplates = [self.fetchRequestTemplates mutableCopy];
+        [fetchRequestTemplates setObject:fetchRequestTemplate forKey:templateKey];
+        self.fetchRequestTemplates = fetchRequestTemplates;
+        RKLogDebug(@"Prepared fetch request template %@", fetchRequestTemplate);
+    });
+    return fetchRequestTemplate;
+}
+
+- (NSUInteger)fetchCount
+{
+    @synchronized(self) {
+        return _fetchCount;
+    }
+}
+
+- (void)incrementFetchCount
+{
+    @synchronized(self) {
+        _fetchCount++;
+    }
 }
 
 - (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity
@@ -97,33 +230,103 @@ static NSPredicate *RKPredicateWithSubsitutionVariablesForAttributeValues(NSDict
     
     if ([attributeValues count] == 0) return [NSSet set];
     
-    NSString *predicateCacheKey = RKPredicateCacheKeyForAttributeValues(attributeValues);
-    
-    __block NSPredicate *substitutionPredicate;
-    dispatch_sync(self.cacheQueue, ^{
-        substitutionPredicate = [self.predicateCache objectForKey:predicateCacheKey];
-    });
-         
-    if (! substitutionPredicate) {
-        substitutionPredicate = RKPredicateWithSubsitutionVariablesForAttributeValues(attributeValues);
-        dispatch_barrier_async(self.cacheQueue, ^{
-            [self.predicateCache setObject:substitutionPredicate forKey:predicateCacheKey];
-        });
-    }
-    
-    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:[entity name]];
-    fetchRequest.predicate = [substitutionPredicate predicateWithSubstitutionVariables:attributeValues];
+    NSFetchRequest *fetchRequest = [[self fetchRequestTemplateForEntity:entity attributeValues:attributeValues] fetchRequestWithAttributeValues:attributeValues];
     __block NSError *error = nil;
     __block NSArray *objects = nil;
     [managedObjectContext performBlockAndWait:^{
         objects = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
     }];
+    [self incrementFetchCount];
     if (! objects) {
         RKLogError(@"Failed to execute fetch request due to error: %@", error);
     }
     RKLogDebug(@"Found objects '%@' using fetchRequest '%@'", objects, fetchRequest);
 
-    return [NSSet setWithArray:objects];
+    if ([objects count] == 0) return [NSSet set];
+    return ([objects count] == 1) ? [NSSet setWithObject:[objects lastObject]] : [NSSet setWithArray:objects];
+}
+
+- (NSDictionary *)managedObjectsWithEntity:(NSEntityDescription *)entity
+                 attributeValuesCollection:(NSArray *)attributeValuesCollection
+                    inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSAssert(entity, @"Cannot find existing managed object without a target class");
+    NSAssert(attributeValuesCollection, @"Cannot retrieve cached objects without attribute values to identify them with.");
+    NSAssert(managedObjectContext, @"Cannot find existing managed object with a nil context");
+
+    NSMutableDictionary *objectsByAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeValuesCollection count]];
+
+    // Group the dictionaries by the attributes they specify so that each fetch request compares the same attributes. Dictionaries containing collection values are resolved individually.
+    NSMutableDictionary *attributeValuesCollectionsByAttributeNames = [NSMutableDictionary dictionary];
+    for (NSDictionary *attributeValues in attributeValuesCollection) {
+        if ([objectsByAttributeValues objectForKey:attributeValues]) continue;
+        BOOL containsCollection = [[attributeValues allValues] indexOfObjectPassingTest:^BOOL(id value, NSUInteger idx, BOOL *stop) {
+            return RKObjectIsCollection(value);
+        }] != NSNotFound;
+        if ([attributeValues count] == 0 || containsCollection) {
+            [objectsByAttributeValues setObject:[self managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext] forKey:attributeValues];
+            continue;
+        }
+
+        NSArray *attributeNames = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
+        NSMutableOrderedSet *attributeValuesForNames = [attributeValuesCollectionsByAttributeNames objectForKey:attributeNames];
+        if (! attributeValuesForNames) {
+            attributeValuesForNames = [NSMutableOrderedSet orderedSet];
+            [attributeValuesCollectionsByAttributeNames setObject:attributeValuesForNames forKey:attributeNames];
+        }
+        [attributeValuesForNames addObject:attributeValues];
+    }
+
+    [attributeValuesCollectionsByAttributeNames enumerateKeysAndObjectsUsingBlock:^(NSArray *attributeNames, NSOrderedSet *attributeValuesForNames, BOOL *stop) {
+        NSArray *allAttributeValues = [attributeValuesForNames array];
+        for (NSUInteger location = 0; location < [allAttributeValues count]; location += RKFetchRequestManagedObjectCacheBatchSize) {
+            NSRange range = NSMakeRange(location, MIN(RKFetchRequestManagedObjectCacheBatchSize, [allAttributeValues count] - location));
+            NSArray *batch = [allAttributeValues subarrayWithRange:range];
+            NSFetchRequest *fetchRequest = [NSFetchRequest new];
+            fetchRequest.entity = entity;
+            fetchRequest.predicate = RKPredicateForAttributeValuesCollection(attributeNames, batch);
+            fetchRequest.returnsObjectsAsFaults = NO;
+            __block NSError *error = nil;
+            __block NSMutableDictionary *fetchedObjectsByAttributeValues = nil;
+            __block NSArray *objects = nil;
+            [managedObjectContext performBlockAndWait:^{
+                objects = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
+                fetchedObjectsByAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[objects count]];
+                for (NSManagedObject *object in objects) {
+                    NSDictionary *attributeValues = [object dictionaryWithValuesForKeys:attributeNames];
+                    NSMutableSet *matchingObjects = [fetchedObjectsByAttributeValues objectForKey:attributeValues];
+                    if (matchingObjects) [matchingObjects addObject:object];
+                    else [fetchedObjectsByAttributeValues setObject:[NSMutableSet setWithObject:object] forKey:attributeValues];
+                }
+            }];
+            [self incrementFetchCount];
+            if (! objects) {
+                RKLogError(@"Failed to execute fetch request due to error: %@", error);
+            }
+            RKLogDebug(@"Found %ld objects for %ld attribute value dictionaries using fetchRequest '%@'", (long)[objects count], (long)[batch count], fetchRequest);
+
+            NSMutableSet *matchedObjects = [NSMutableSet setWithCapacity:[objects count]];
+            NSMutableArray *unmatchedAttributeValues = [NSMutableArray array];
+            for (NSDictionary *attributeValues in batch) {
+                NSSet *matchingObjects = [fetchedObjectsByAttributeValues objectForKey:attributeValues];
+                if (matchingObjects) {
+                    [objectsByAttributeValues setObject:matchingObjects forKey:attributeValues];
+                    [matchedObjects unionSet:matchingObjects];
+                } else {
+                    [unmatchedAttributeValues addObject:attributeValues];
+                }
+            }
+
+            // Fetched objects that no dictionary matched in memory indicate values of a different type than the attribute (such as a string for a numeric attribute), which only the store can compare
+            BOOL hasUnmatchedObjects = [matchedObjects count] < [objects count];
+            for (NSDictionary *attributeValues in unmatchedAttributeValues) {
+                NSSet *matchingObjects = hasUnmatchedObjects ? [self managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext] : [NSSet set];
+                [objectsByAttributeValues setObject:matchingObjects forKey:attributeValues];
+            }
+        }
+    }];
+
+    return objectsByAttributeValues;
 }
 
 @end
@@ -0,0 +1,47 @@
+//
+//  RKIdentityMapManagedObjectCache.h
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKManagedObjectCaching.h"
+
+@class RKFetchRequestManagedObjectCache;
+
+/**
+ Provides a managed object cache that combines the lazy loading of the `RKFetchRequestManagedObjectCache` with the in-memory lookups of the `RKInMemoryManagedObjectCache`, without loading every instance of an entity up front.
+
+ The receiver keeps an identity map for each managed object context it is asked to look up objects in, associating the attribute values of each lookup with the objects that matched them. The identity map is populated by the results of lookups and with the objects that the mapping fetches, creates and deletes, so that an object is only ever fetched once while mapping a response, however many times the response refers to it. Lookups that are not in the identity map are satisfied by fetch requests, batching the lookups for an entire collection of representations into a single fetch request where possible.
+
+ Lookups that match no objects are remembered as well, so that a response referring to the same new object many times does not query the persistent store for it more than once. Once the object has been created by the mapping, it is found in the identity map: objects created in a context are added to the results of earlier lookups that they match with the attribute values they are created with, which for objects created by an `RKManagedObjectMappingOperationDataSource` are their identification attributes.
+
+ ## Scope of the Identity Map
+
+ The identity map of a managed object context lives as long as the context itself, which makes the receiver best suited to the short lived private queue contexts that `RKManagedObjectRequestOperation` maps responses in. As the contents of the persistent store may be changed by any context, the identity maps of all contexts are discarded whenever a managed object context saves.
+ */
+@interface RKIdentityMapManagedObjectCache : NSObject <RKManagedObjectCaching>
+
+///-------------------------------------
+/// @name Accessing the Underlying Cache
+///-------------------------------------
+
+/**
+ The fetch request cache that satisfies lookups that miss the identity map. Its `fetchCount` is the number of times the receiver has queried the persistent store.
+ */
+@property (nonatomic, strong, readonly) RKFetchRequestManagedObjectCache *fetchRequestCache;
+
+@end
@@ -0,0 +1,288 @@
+//
+//  RKIdentityMapManagedObjectCache.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <objc/runtime.h>
+#import "RKIdentityMapManagedObjectCache.h"
+#import "RKFetchRequestManagedObjectCache.h"
+#import "RKObjectUtilities.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitCoreData
+
+static BOOL RKAttributeValuesContainCollection(NSDictionary *attributeValues)
+{
+    for (id value in [attributeValues allValues]) {
+        if (RKObjectIsCollection(value)) return YES;
+    }
+    return NO;
+}
+
+/**
+ The identity map of a single managed object context, associating the attribute values of lookups with the objects matching them. Results are recorded by entity name, and the attribute names of each lookup are remembered so that objects created or fetched later can be added to the results they match.
+ */
+@interface RKIdentityMap : NSObject
+@property (nonatomic, assign, readonly) NSUInteger generation;
+@property (nonatomic, strong) NSMutableDictionary *objectsByAttributeValuesByEntityName;
+@property (nonatomic, strong) NSMutableDictionary *attributeNamesByEntityName;
+
+- (id)initWithGeneration:(NSUInteger)generation;
+- (NSSet *)objectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues;
+- (void)setObjects:(NSSet *)objects withEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues;
+- (void)addObject:(NSManagedObject *)managedObject;
+- (void)removeObject:(NSManagedObject *)managedObject;
+@end
+
+@implementation RKIdentityMap
+
+- (id)initWithGeneration:(NSUInteger)generation
+{
+    self = [super init];
+    if (self) {
+        _generation = generation;
+        self.objectsByAttributeValuesByEntityName = [NSMutableDictionary dictionary];
+        self.attributeNamesByEntityName = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+// Returns `nil` if the attribute values have not been looked up or the objects recorded for them no longer match
+- (NSSet *)objectsWithEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    @synchronized(self) {
+        NSMutableDictionary *objectsByAttributeValues = [self.objectsByAttributeValuesByEntityName objectForKey:[entity name]];
+        NSSet *objects = [objectsByAttributeValues objectForKey:attributeValues];
+        if ([objects count] == 0) return objects;
+
+        NSMutableSet *matchingObjects = nil;
+        for (NSManagedObject *managedObject in objects) {
+            if ([managedObject isDeleted] || [managedObject managedObjectContext] == nil) {
+                if (! matchingObjects) matchingObjects = [objects mutableCopy];
+                [matchingObjects removeObject:managedObject];
+                continue;
+            }
+            for (NSString *attributeName in attributeValues) {
+                id value = [managedObject valueForKey:attributeName] ?: [NSNull null];
+                if (! [value isEqual:[attributeValues objectForKey:attributeName]]) {
+                    [objectsByAttributeValues removeObjectForKey:attributeValues];
+                    return nil;
+                }
+            }
+        }
+        if (matchingObjects) {
+            objects = [matchingObjects copy];
+            [objectsByAttributeValues setObject:objects forKey:attributeValues];
+        }
+        return objects;
+    }
+}
+
+- (void)setObjects:(NSSet *)objects withEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues
+{
+    @synchronized(self) {
+        NSMutableDictionary *objectsByAttributeValues = [self.objectsByAttributeValuesByEntityName objectForKey:[entity name]];
+        if (! objectsByAttributeValues) {
+            objectsByAttributeValues = [NSMutableDictionary dictionary];
+            [self.objectsByAttributeValuesByEntityName setObject:objectsByAttributeValues forKey:[entity name]];
+        }
+        [objectsByAttributeValues setObject:objects forKey:attributeValues];
+
+        NSMutableSet *attributeNames = [self.attributeNamesByEntityName objectForKey:[entity name]];
+        if (! attributeNames) {
+            attributeNames = [NSMutableSet set];
+            [self.attributeNamesByEntityName setObject:attributeNames forKey:[entity name]];
+        }
+        [attributeNames addObject:[[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)]];
+    }
+}
+
+// Enumerates the recorded results of the entity of the object and its superentities that the object matches with its current attribute values
+- (void)enumerateObjectsMatchingObject:(NSManagedObject *)managedObject usingBlock:(void (^)(NSMutableDictionary *objectsByAttributeValues, NSDictionary *attributeValues, NSSet *objects))block
+{
+    for (NSEntityDescription *entity = [managedObject entity]; entity; entity = [entity superentity]) {
+        NSMutableDictionary *objectsByAttributeValues = [self.objectsByAttributeValuesByEntityName objectForKey:[entity name]];
+        if (! objectsByAttributeValues) continue;
+        for (NSArray *attributeNames in [self.attributeNamesByEntityName objectForKey:[entity name]]) {
+            NSDictionary *attributeValues = [managedObject dictionaryWithValuesForKeys:attributeNames];
+            NSSet *objects = [objectsByAttributeValues objectForKey:attributeValues];
+            if (objects) block(objectsByAttributeValues, attributeValues, objects);
+        }
+    }
+}
+
+- (void)addObject:(NSManagedObject *)managedObject
+{
+    @synchronized(self) {
+        [self enumerateObjectsMatchingObject:managedObject usingBlock:^(NSMutableDictionary *objectsByAttributeValues, NSDictionary *attributeValues, NSSet *objects) {
+            if (! [objects containsObject:managedObject]) [objectsByAttributeValues setObject:[objects setByAddingObject:managedObject] forKey:attributeValues];
+        }];
+    }
+}
+
+- (void)removeObject:(NSManagedObject *)managedObject
+{
+    @synchronized(self) {
+        [self enumerateObjectsMatchingObject:managedObject usingBlock:^(NSMutableDictionary *objectsByAttributeValues, NSDictionary *attributeValues, NSSet *objects) {
+            if (! [objects containsObject:managedObject]) return;
+            NSMutableSet *remainingObjects = [objects mutableCopy];
+            [remainingObjects removeObject:managedObject];
+            [objectsByAttributeValues setObject:remainingObjects forKey:attributeValues];
+        }];
+    }
+}
+
+@end
+
+@interface RKIdentityMapManagedObjectCache ()
+@property (nonatomic, strong, readwrite) RKFetchRequestManagedObjectCache *fetchRequestCache;
+@property (nonatomic, assign) NSUInteger generation;
+@end
+
+@implementation RKIdentityMapManagedObjectCache
+
+- (id)init
+{
+    self = [super init];
+    if (self) {
+        self.fetchRequestCache = [RKFetchRequestManagedObjectCache new];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(managedObjectContextDidSave:)
+                                                     name:NSManagedObjectContextDidSaveNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)managedObjectContextDidSave:(NSNotification *)notification
+{
+    // Invalidates the identity maps of every context, which are replaced on their next lookup
+    @synchronized(self) {
+        _generation++;
+    }
+}
+
+- (NSUInteger)generation
+{
+    @synchronized(self) {
+        return _generation;
+    }
+}
+
+// The identity map of a context is associated with the context, keyed by the receiver, so that it is released along with the context
+- (RKIdentityMap *)identityMapForManagedObjectContext:(NSManagedObjectContext *)managedObjectContext createIfNecessary:(BOOL)createIfNecessary
+{
+    if (! managedObjectContext) return nil;
+    NSUInteger generation = self.generation;
+    RKIdentityMap *identityMap = objc_getAssociatedObject(managedObjectContext, (__bridge const void *)self);
+    if (identityMap && identityMap.generation == generation) return identityMap;
+    if (! createIfNecessary) return nil;
+
+    @synchronized(managedObjectContext) {
+        identityMap = objc_getAssociatedObject(managedObjectContext, (__bridge const void *)self);
+        if (! identityMap || identityMap.generation != generation) {
+            identityMap = [[RKIdentityMap alloc] initWithGeneration:generation];
+            objc_setAssociatedObject(managedObjectContext, (__bridge const void *)self, identityMap, OBJC_ASSOCIATION_RETAIN);
+        }
+    }
+    return identityMap;
+}
+
+- (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity
+                    attributeValues:(NSDictionary *)attributeValues
+             inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSAssert(entity, @"Cannot find existing managed object without a target class");
+    NSAssert(attributeValues, @"Cannot retrieve cached objects without attribute values to identify them with.");
+    NSAssert(managedObjectContext, @"Cannot find existing managed object with a nil context");
+
+    RKIdentityMap *identityMap = [self identityMapForManagedObjectContext:managedObjectContext createIfNecessary:YES];
+    BOOL containsCollection = RKAttributeValuesContainCollection(attributeValues);
+    if (! containsCollection) {
+        NSSet *objects = [identityMap objectsWithEntity:entity attributeValues:attributeValues];
+        if (objects) {
+            RKLogTrace(@"Found objects '%@' in identity map for attribute values %@", objects, attributeValues);
+            return objects;
+        }
+    }
+
+    NSSet *objects = [self.fetchRequestCache managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+    if (containsCollection) {
+        for (NSManagedObject *managedObject in objects) [identityMap addObject:managedObject];
+    } else {
+        [identityMap setObjects:objects withEntity:entity attributeValues:attributeValues];
+    }
+    return objects;
+}
+
+- (NSDictionary *)managedObjectsWithEntity:(NSEntityDescription *)entity
+                 attributeValuesCollection:(NSArray *)attributeValuesCollection
+                    inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSAssert(entity, @"Cannot find existing managed object without a target class");
+    NSAssert(attributeValuesCollection, @"Cannot retrieve cached objects without a collection of attribute values to identify them with.");
+    NSAssert(managedObjectContext, @"Cannot find existing managed object with a nil context");
+
+    RKIdentityMap *identityMap = [self identityMapForManagedObjectContext:managedObjectContext createIfNecessary:YES];
+    NSMutableDictionary *objectsByAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeValuesCollection count]];
+    NSMutableArray *missingAttributeValuesCollection = [NSMutableArray array];
+    for (NSDictionary *attributeValues in attributeValuesCollection) {
+        NSSet *objects = RKAttributeValuesContainCollection(attributeValues) ? nil : [identityMap objectsWithEntity:entity attributeValues:attributeValues];
+        if (objects) [objectsByAttributeValues setObject:objects forKey:attributeValues];
+        else [missingAttributeValuesCollection addObject:attributeValues];
+    }
+    RKLogDebug(@"Found %ld of %ld attribute value dictionaries of Entity '%@' in identity map", (long)[objectsByAttributeValues count], (long)[attributeValuesCollection count], [entity name]);
+    if ([missingAttributeValuesCollection count] == 0) return objectsByAttributeValues;
+
+    NSDictionary *fetchedObjectsByAttributeValues = [self.fetchRequestCache managedObjectsWithEntity:entity
+                                                                           attributeValuesCollection:missingAttributeValuesCollection
+                                                                              inManagedObjectContext:managedObjectContext];
+    [fetchedObjectsByAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSDictionary *attributeValues, NSSet *objects, BOOL *stop) {
+        if (RKAttributeValuesContainCollection(attributeValues)) {
+            for (NSManagedObject *managedObject in objects) [identityMap addObject:managedObject];
+        } else {
+            [identityMap setObjects:objects withEntity:entity attributeValues:attributeValues];
+        }
+    }];
+    [objectsByAttributeValues addEntriesFromDictionary:fetchedObjectsByAttributeValues];
+    return objectsByAttributeValues;
+}
+
+- (void)didFetchObject:(NSManagedObject *)object
+{
+    [[self identityMapForManagedObjectContext:[object managedObjectContext] createIfNecessary:NO] addObject:object];
+}
+
+- (void)didCreateObject:(NSManagedObject *)object
+{
+    [[self identityMapForManagedObjectContext:[object managedObjectContext] createIfNecessary:NO] addObject:object];
+}
+
+- (void)didDeleteObject:(NSManagedObject *)object
+{
+    [[self identityMapForManagedObjectContext:[object managedObjectContext] createIfNecessary:NO] removeObject:object];
+}
+
+@end
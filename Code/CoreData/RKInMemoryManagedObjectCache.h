@@ -20,8 +20,12 @@
 
 #import "RKManagedObjectCaching.h"
 
+@class RKEntityCache;
+
 /**
  Provides a fast managed object cache where-in object instances are retained in memory to avoid hitting the Core Data persistent store. Performance is greatly increased over fetch request based strategy at the expense of memory consumption.
+
+ The in-memory cache for an entity and set of attributes is loaded asynchronously, either explicitly via `loadEntity:byAttributes:completion:` or implicitly by the first lookup that requires it. Lookups never wait for a cache to load: until it has finished loading, they are satisfied by fetch requests in the same manner as an `RKFetchRequestManagedObjectCache`.
  */
 @interface RKInMemoryManagedObjectCache : NSObject <RKManagedObjectCaching>
 
@@ -37,4 +41,42 @@
  */
 - (id)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext;
 
+///---------------------------
+/// @name Preloading the Cache
+///---------------------------
+
+/**
+ Asynchronously loads the in-memory cache of the instances of the given entity by the given attributes, so that lookups by those attributes are satisfied from memory once loading has finished. Requests to load a cache that is already loading are coalesced, and the completion of a request to load a cache that has already loaded is invoked immediately.
+
+ @param entity The entity whose instances are to be cached.
+ @param attributeNames The names of the attributes by which instances of the entity are identified. The order of the names is not significant.
+ @param completion A block to be executed on the main queue once the cache has been loaded. Can be `nil`.
+ @see `[RKObjectManager prewarmWithCompletion:]`
+ */
+- (void)loadEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames completion:(void (^)(void))completion;
+
+///---------------------------------------
+/// @name Persisting Caches Across Launches
+///---------------------------------------
+
+/**
+ A Boolean value that determines if the receiver persists the caches it loads in identity index files alongside the SQLite persistent store of each cached entity, so that on the next launch they are loaded from the index rather than with a fetch of every instance of the entity.
+
+ Index files are written to a directory next to the store file, such as the store created by `[RKManagedObjectStore addSQLitePersistentStoreAtPath:fromSeedDatabaseAtPath:withConfiguration:options:error:]`, and are rewritten in the background after the observed managed object context saves. Each save also stamps the metadata of the store with a new generation, which is recorded in the index, so that an index that was not rewritten after the last save is detected as out of date and ignored. Indexes are likewise ignored if the store is replaced or the entity is changed by a new version of the managed object model.
+
+ **Default**: `NO`
+
+ @warning Only saves of the observed managed object context are tracked, so it must be the context that saves to the persistent store coordinator, such as the `persistentStoreManagedObjectContext` of an `RKManagedObjectStore`. Caches for entities that are not stored in a SQLite persistent store are not persisted.
+ */
+@property (nonatomic, assign) BOOL persistsIdentityIndexes;
+
+///-------------------------------------
+/// @name Accessing the Underlying Cache
+///-------------------------------------
+
+/**
+ The entity cache backing the receiver. Configure its `maximumObjectIDCount` to bound the memory consumed by the receiver and inspect its hit, miss and eviction counts to size the limit.
+ */
+@property (nonatomic, strong, readonly) RKEntityCache *entityCache;
+
 @end
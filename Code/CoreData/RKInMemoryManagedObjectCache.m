@@ -22,6 +22,7 @@
 #import "RKEntityCache.h"
 #import "RKLog.h"
 #import "RKEntityByAttributeCache.h"
+#import "RKFetchRequestManagedObjectCache.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -47,9 +48,35 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     return callbackQueue;
 }
 
+// The key of the store metadata recording the save that identity indexes must have been written after
+static NSString * const RKInMemoryManagedObjectCacheIdentityIndexGenerationMetadataKey = @"RKIdentityIndexGeneration";
+
+// Identity indexes are rewritten once per interval at most, however often the observed context saves
+static NSTimeInterval const RKInMemoryManagedObjectCacheIdentityIndexWriteDelay = 1.0;
+
+static dispatch_queue_t RKInMemoryManagedObjectCacheIdentityIndexQueue(void)
+{
+    static dispatch_once_t onceToken;
+    static dispatch_queue_t identityIndexQueue;
+    dispatch_once(&onceToken, ^{
+        identityIndexQueue = dispatch_queue_create("org.restkit.core-data.in-memory-cache.identity-index-queue", DISPATCH_QUEUE_SERIAL);
+    });
+    return identityIndexQueue;
+}
+
+// Attribute names are sorted so that a cache is shared by every ordering of the same identification attributes
+static NSArray *RKSortedAttributeNames(NSArray *attributeNames)
+{
+    return [attributeNames sortedArrayUsingSelector:@selector(compare:)];
+}
+
 @interface RKInMemoryManagedObjectCache ()
 @property (nonatomic, strong, readwrite) RKEntityCache *entityCache;
 @property (nonatomic, assign) dispatch_queue_t callbackQueue;
+@property (nonatomic, weak) NSManagedObjectContext *managedObjectContext;
+@property (nonatomic, strong) RKFetchRequestManagedObjectCache *fetchRequestCache;
+@property (nonatomic, strong) NSMutableDictionary *loadCompletionBlocks;
+@property (nonatomic, assign) BOOL identityIndexWriteScheduled;
 @end
 
 @implementation RKInMemoryManagedObjectCache
@@ -62,8 +89,13 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
         [cacheContext setPersistentStoreCoordinator:RKPersistentStoreCoordinatorFromManagedObjectContext(managedObjectContext)];
         self.entityCache = [[RKEntityCache alloc] initWithManagedObjectContext:cacheContext];
         self.entityCache.callbackQueue = RKInMemoryManagedObjectCacheCallbackQueue();
+        self.managedObjectContext = managedObjectContext;
+        self.fetchRequestCache = [RKFetchRequestManagedObjectCache new];
+        self.loadCompletionBlocks = [NSMutableDictionary dictionary];
         
         [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(handleManagedObjectContextDidChangeNotification:) name:NSManagedObjectContextObjectsDidChangeNotification object:managedObjectContext];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(handleManagedObjectContextWillSaveNotification:) name:NSManagedObjectContextWillSaveNotification object:managedObjectContext];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(handleManagedObjectContextDidSaveNotification:) name:NSManagedObjectContextDidSaveNotification object:managedObjectContext];
     }
     return self;
 }
@@ -81,6 +113,82 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     [[NSNotificationCenter defaultCenter] removeObserver:self];
 }
 
+- (void)loadEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames completion:(void (^)(void))completion
+{
+    [self loadEntity:entity byAttributes:attributeNames pendingObjectsContext:nil completion:completion];
+}
+
+/*
+ Loads the attribute cache asynchronously. Loads requested while the same cache is loading are coalesced, with each completion block invoked once the load has finished. Pending objects are not visible to the dictionary fetch that loads the cache, so the inserted and updated objects of the observed context and of the context that requested the load are added once it has finished.
+ */
+- (void)loadEntity:(NSEntityDescription *)entity byAttributes:(NSArray *)attributeNames pendingObjectsContext:(NSManagedObjectContext *)pendingObjectsContext completion:(void (^)(void))completion
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(attributeNames);
+    NSArray *attributes = RKSortedAttributeNames(attributeNames);
+    if ([self.entityCache isEntity:entity cachedByAttributes:attributes]) {
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        return;
+    }
+
+    NSArray *loadKey = @[ entity.name, attributes ];
+    @synchronized(self.loadCompletionBlocks) {
+        NSMutableArray *completionBlocks = [self.loadCompletionBlocks objectForKey:loadKey];
+        if (completionBlocks) {
+            if (completion) [completionBlocks addObject:[completion copy]];
+            return;
+        }
+        completionBlocks = [NSMutableArray array];
+        if (completion) [completionBlocks addObject:[completion copy]];
+        [self.loadCompletionBlocks setObject:completionBlocks forKey:loadKey];
+    }
+
+    RKLogInfo(@"Caching instances of Entity '%@' by attributes '%@'", entity.name, [attributes componentsJoinedByString:@", "]);
+    __weak NSManagedObjectContext *weakPendingObjectsContext = pendingObjectsContext;
+    NSString *identityIndexPath = nil;
+    NSDictionary *identityIndexMetadata = nil;
+    if (self.persistsIdentityIndexes) {
+        NSPersistentStore *persistentStore = [self persistentStoreForEntity:entity];
+        identityIndexPath = [self identityIndexPathForEntity:entity attributes:attributes persistentStore:persistentStore];
+        identityIndexMetadata = [self identityIndexMetadataForEntity:entity attributes:attributes persistentStore:persistentStore];
+    }
+    [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes identityIndexPath:(identityIndexMetadata ? identityIndexPath : nil) metadata:identityIndexMetadata completion:^{
+        RKEntityByAttributeCache *attributeCache = [self.entityCache attributeCacheForEntity:entity attributes:attributes];
+        NSMutableSet *contexts = [NSMutableSet set];
+        if (self.managedObjectContext) [contexts addObject:self.managedObjectContext];
+        if (weakPendingObjectsContext) [contexts addObject:weakPendingObjectsContext];
+
+        dispatch_group_t dispatchGroup = dispatch_group_create();
+        for (NSManagedObjectContext *context in contexts) {
+            dispatch_group_enter(dispatchGroup);
+            [context performBlock:^{
+                NSMutableSet *pendingObjects = [NSMutableSet set];
+                for (NSManagedObject *managedObject in [[context insertedObjects] setByAddingObjectsFromSet:[context updatedObjects]]) {
+                    if ([managedObject.entity isKindOfEntity:entity]) [pendingObjects addObject:managedObject];
+                }
+                [attributeCache addObjects:pendingObjects completion:^{
+                    dispatch_group_leave(dispatchGroup);
+                }];
+            }];
+        }
+
+        dispatch_group_notify(dispatchGroup, self.callbackQueue ?: dispatch_get_main_queue(), ^{
+            RKLogTrace(@"Cached %ld objects", (long)[attributeCache count]);
+            NSArray *completionBlocks;
+            @synchronized(self.loadCompletionBlocks) {
+                completionBlocks = [self.loadCompletionBlocks objectForKey:loadKey];
+                [self.loadCompletionBlocks removeObjectForKey:loadKey];
+            }
+            for (void (^completionBlock)(void) in completionBlocks) {
+                completionBlock();
+            }
+        });
+#if !OS_OBJECT_USE_OBJC
+        dispatch_release(dispatchGroup);
+#endif
+    }];
+}
+
 - (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity
                     attributeValues:(NSDictionary *)attributeValues
              inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
@@ -89,47 +197,41 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     NSParameterAssert(attributeValues);
     NSParameterAssert(managedObjectContext);
     
-    NSArray *attributes = [attributeValues allKeys];
+    NSArray *attributes = RKSortedAttributeNames([attributeValues allKeys]);
     if (! [self.entityCache isEntity:entity cachedByAttributes:attributes]) {
-        RKLogInfo(@"Caching instances of Entity '%@' by attributes '%@'", entity.name, [attributes componentsJoinedByString:@", "]);
-        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
-        [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes completion:^{
-            dispatch_semaphore_signal(semaphore);
-        }];
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
-        
-        RKEntityByAttributeCache *attributeCache = [self.entityCache attributeCacheForEntity:entity attributes:attributes];
-        
-        // Fetch any pending objects and add them to the cache
-        NSFetchRequest *fetchRequest = [NSFetchRequest new];
-        fetchRequest.entity = entity;
-        fetchRequest.includesPendingChanges = YES;
-        
-        [managedObjectContext performBlockAndWait:^{
-            NSError *error = nil;
-            NSArray *objects = nil;
-            objects = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
-            if (objects) {
-                [attributeCache addObjects:[NSSet setWithArray:objects] completion:^{
-                    dispatch_semaphore_signal(semaphore);
-                }];
-            } else {
-                RKLogError(@"Fetched pre-loading existing managed objects with error: %@", error);
-                dispatch_semaphore_signal(semaphore);
-            }
-        }];
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
-        
-#if !OS_OBJECT_USE_OBJC
-        dispatch_release(semaphore);
-#endif
-        
-        RKLogTrace(@"Cached %ld objects", (long)[attributeCache count]);
+        // Rather than waiting for the cache to load, satisfy the lookup with a fetch request
+        [self loadEntity:entity byAttributes:attributes pendingObjectsContext:managedObjectContext completion:nil];
+        return [self.fetchRequestCache managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
     }
     
     return [self.entityCache objectsForEntity:entity withAttributeValues:attributeValues inContext:managedObjectContext];
 }
 
+- (NSDictionary *)managedObjectsWithEntity:(NSEntityDescription *)entity
+                 attributeValuesCollection:(NSArray *)attributeValuesCollection
+                    inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(attributeValuesCollection);
+    NSParameterAssert(managedObjectContext);
+
+    // Until the cache has loaded, the collection is identified with batched fetch requests
+    NSArray *attributes = RKSortedAttributeNames([[attributeValuesCollection lastObject] allKeys] ?: @[]);
+    if ([attributes count] && ! [self.entityCache isEntity:entity cachedByAttributes:attributes]) {
+        [self loadEntity:entity byAttributes:attributes pendingObjectsContext:managedObjectContext completion:nil];
+        return [self.fetchRequestCache managedObjectsWithEntity:entity attributeValuesCollection:attributeValuesCollection inManagedObjectContext:managedObjectContext];
+    }
+
+    // A loaded cache resolves each set of attribute values in memory
+    NSMutableDictionary *objectsByAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeValuesCollection count]];
+    for (NSDictionary *attributeValues in attributeValuesCollection) {
+        if ([objectsByAttributeValues objectForKey:attributeValues]) continue;
+        NSSet *objects = [self managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+        [objectsByAttributeValues setObject:objects forKey:attributeValues];
+    }
+    return objectsByAttributeValues;
+}
+
 - (void)didFetchObject:(NSManagedObject *)object
 {
     [self.entityCache addObjects:[NSSet setWithObject:object] completion:nil];
@@ -154,11 +256,119 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     NSSet *deletedObjects = [userInfo objectForKey:NSDeletedObjectsKey];
     RKLogTrace(@"insertedObjects=%@, updatedObjects=%@, deletedObjects=%@", insertedObjects, updatedObjects, deletedObjects);
     
-    NSMutableSet *objectsToAdd = [NSMutableSet setWithSet:insertedObjects];
-    [objectsToAdd unionSet:updatedObjects];
-    
-    [self.entityCache addObjects:objectsToAdd completion:nil];
+    // Updated objects are only reindexed if an identification attribute has changed
+    [self.entityCache addObjects:insertedObjects completion:nil];
+    [self.entityCache updateObjects:updatedObjects completion:nil];
     [self.entityCache removeObjects:deletedObjects completion:nil];
 }
 
+#pragma mark - Identity Indexes
+
+// Returns the SQLite store holding instances of the given entity, or `nil` if they are not held in one
+- (NSPersistentStore *)persistentStoreForEntity:(NSEntityDescription *)entity
+{
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = self.entityCache.managedObjectContext.persistentStoreCoordinator;
+    for (NSPersistentStore *persistentStore in [persistentStoreCoordinator persistentStores]) {
+        if (! [persistentStore.type isEqualToString:NSSQLiteStoreType]) continue;
+        NSArray *entities = [persistentStoreCoordinator.managedObjectModel entitiesForConfiguration:persistentStore.configurationName];
+        if ([entities count] == 0 || [[entities valueForKey:@"name"] containsObject:entity.name]) return persistentStore;
+    }
+    return nil;
+}
+
+- (NSString *)identityIndexPathForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames persistentStore:(NSPersistentStore *)persistentStore
+{
+    if (! [persistentStore.URL isFileURL]) return nil;
+    NSString *directoryPath = [[persistentStore.URL path] stringByAppendingString:@"-identity-index"];
+    return [directoryPath stringByAppendingPathComponent:[NSString stringWithFormat:@"%@.%@.index", entity.name, [attributeNames componentsJoinedByString:@","]]];
+}
+
+/*
+ The metadata identifies the store by its UUID, which changes when the store is replaced or reset, the last save to the store by the generation written to the store metadata as it was saved, and the entity by its version hash.
+ */
+- (NSDictionary *)identityIndexMetadataForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames persistentStore:(NSPersistentStore *)persistentStore
+{
+    if (! persistentStore) return nil;
+    NSDictionary *storeMetadata = [self.entityCache.managedObjectContext.persistentStoreCoordinator metadataForPersistentStore:persistentStore];
+    NSString *storeUUID = [storeMetadata objectForKey:NSStoreUUIDKey];
+    NSString *generation = [storeMetadata objectForKey:RKInMemoryManagedObjectCacheIdentityIndexGenerationMetadataKey];
+    if (! storeUUID || ! generation || ! entity.versionHash) return nil;
+    return @{ @"storeUUID": storeUUID, @"generation": generation, @"entityVersionHash": entity.versionHash, @"attributes": attributeNames };
+}
+
+- (void)handleManagedObjectContextWillSaveNotification:(NSNotification *)notification
+{
+    NSManagedObjectContext *managedObjectContext = notification.object;
+    if (! self.persistsIdentityIndexes || managedObjectContext.parentContext) return;
+
+    // Every save moves the store on to a new generation, so that an index that is not rewritten after the save is out of date
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = managedObjectContext.persistentStoreCoordinator;
+    NSString *generation = [[NSProcessInfo processInfo] globallyUniqueString];
+    for (NSPersistentStore *persistentStore in [persistentStoreCoordinator persistentStores]) {
+        if (! [persistentStore.type isEqualToString:NSSQLiteStoreType]) continue;
+        NSMutableDictionary *storeMetadata = [[persistentStoreCoordinator metadataForPersistentStore:persistentStore] mutableCopy];
+        [storeMetadata setObject:generation forKey:RKInMemoryManagedObjectCacheIdentityIndexGenerationMetadataKey];
+        [persistentStoreCoordinator setMetadata:storeMetadata forPersistentStore:persistentStore];
+    }
+}
+
+- (void)handleManagedObjectContextDidSaveNotification:(NSNotification *)notification
+{
+    if (! self.persistsIdentityIndexes || [notification.object parentContext]) return;
+
+    // Inserted objects were cached by their temporary IDs, which the save has replaced with permanent IDs
+    [self.entityCache addObjects:[notification.userInfo objectForKey:NSInsertedObjectsKey] completion:nil];
+    [self scheduleIdentityIndexWrite];
+}
+
+- (void)scheduleIdentityIndexWrite
+{
+    @synchronized(self) {
+        if (self.identityIndexWriteScheduled) return;
+        self.identityIndexWriteScheduled = YES;
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(RKInMemoryManagedObjectCacheIdentityIndexWriteDelay * NSEC_PER_SEC)), RKInMemoryManagedObjectCacheIdentityIndexQueue(), ^{
+        [self writeIdentityIndexes];
+    });
+}
+
+/*
+ Snapshots the loaded caches on the queue of the observed context, where no save can be in progress, and writes the indexes in the background. A snapshot is only taken while the context has no unsaved changes, so that the indexes reflect the saved state of the store: otherwise the indexes are left to the next save.
+ */
+- (void)writeIdentityIndexes
+{
+    @synchronized(self) {
+        self.identityIndexWriteScheduled = NO;
+    }
+    NSManagedObjectContext *managedObjectContext = self.managedObjectContext;
+    if (! managedObjectContext) return;
+
+    NSMutableDictionary *identityIndexDataByPath = [NSMutableDictionary dictionary];
+    [managedObjectContext performBlockAndWait:^{
+        if ([managedObjectContext hasChanges]) {
+            RKLogDebug(@"Deferring write of identity indexes: the managed object context %@ has unsaved changes", managedObjectContext);
+            return;
+        }
+        for (NSEntityDescription *entity in self.entityCache.managedObjectContext.persistentStoreCoordinator.managedObjectModel) {
+            for (RKEntityByAttributeCache *attributeCache in [self.entityCache attributeCachesForEntity:entity]) {
+                if (! [attributeCache isLoaded]) continue;
+                NSPersistentStore *persistentStore = [self persistentStoreForEntity:entity];
+                NSString *path = [self identityIndexPathForEntity:entity attributes:attributeCache.attributes persistentStore:persistentStore];
+                NSDictionary *metadata = [self identityIndexMetadataForEntity:entity attributes:attributeCache.attributes persistentStore:persistentStore];
+                if (path && metadata) [identityIndexDataByPath setObject:[attributeCache identityIndexDataWithMetadata:metadata] forKey:path];
+            }
+        }
+    }];
+
+    [identityIndexDataByPath enumerateKeysAndObjectsUsingBlock:^(NSString *path, NSData *data, BOOL *stop) {
+        NSError *error = nil;
+        if (! [[NSFileManager defaultManager] createDirectoryAtPath:[path stringByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:&error] ||
+            ! [data writeToFile:path options:NSDataWritingAtomic error:&error]) {
+            RKLogError(@"Failed to write identity index to path '%@': %@", path, [error localizedDescription]);
+            return;
+        }
+        RKLogDebug(@"Wrote identity index of %ld bytes to path '%@'", (long)[data length], path);
+    }];
+}
+
 @end
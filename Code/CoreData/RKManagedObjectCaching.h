@@ -69,4 +69,22 @@
  */
 - (void)didDeleteObject:(NSManagedObject *)object;
 
+///--------------------------------------------------
+/// @name Retrieving Managed Objects for a Collection
+///--------------------------------------------------
+
+/**
+ Returns the managed objects for a given entity matching each dictionary in a collection of attribute value dictionaries in a given context.
+
+ Implementing this method allows the identification of every object in a mapped collection to be satisfied in a single pass, such as one fetch request with an `IN` predicate, rather than with one invocation of `managedObjectsWithEntity:attributeValues:inManagedObjectContext:` per object.
+
+ @param entity The entity to retrieve managed objects for.
+ @param attributeValuesCollection An array of dictionaries, each specifying the attribute criteria for retrieving a set of managed objects.
+ @param managedObjectContext The context to fetch the matching objects in.
+ @return A dictionary whose keys are the attribute value dictionaries of the given collection and whose values are sets of the managed objects matching each of them. Dictionaries with no matching objects map to an empty set.
+ */
+- (NSDictionary *)managedObjectsWithEntity:(NSEntityDescription *)entity
+                 attributeValuesCollection:(NSArray *)attributeValuesCollection
+                    inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext;
+
 @end
@@ -21,7 +21,7 @@
 #import <CoreData/CoreData.h>
 
 @class RKMapping, RKObjectManager;
-@protocol RKManagedObjectCaching;
+@protocol RKManagedObjectCaching, RKManagedObjectImporterDelegate;
 
 /**
  Instances of `RKManagedObjectImporter` perform bulk imports of managed objects into a persistent store from source files (typically in JSON or XML format) using object mappings. The importer provides functionality for updating an existing persistent store or creating a seed database that can be used to bootstrap a new persistent store with an initial data set.
@@ -116,6 +116,41 @@
  */
 @property (nonatomic, strong) id<RKManagedObjectCaching> managedObjectCache;
 
+///---------------------------------------
+/// @name Streaming Large Files in Batches
+///---------------------------------------
+
+/**
+ The number of representations to map between saves of the managed object context when importing a JSON file whose mappable content is an array. A value of zero disables streaming.
+
+ When non-zero, the elements of the array are parsed incrementally as the file is read rather than parsing the entire file up front. Each batch is mapped, its relationships are connected, and the managed object context is then saved and reset, so that the memory consumed by an import is bounded by the size of a batch rather than by the size of the file. Objects imported by earlier batches are identified through the `managedObjectCache`. Files of other MIME types, and JSON files whose mappable content is not an array, are imported in full. The elements of the array may be objects, arrays or scalar values.
+
+ **Default**: `0`
+
+ @warning As the relationships of each batch are connected before the next batch is read, connections can only be satisfied by objects that were imported by the same or an earlier batch, or that already exist in the persistent store. The deferred connections of files imported earlier are performed before a file is streamed, as the context is reset between its batches.
+ */
+@property (nonatomic, assign) NSUInteger batchSize;
+
+/**
+ The delegate of the importer, which is informed of the progress of streaming imports.
+ */
+@property (nonatomic, weak) id<RKManagedObjectImporterDelegate> delegate;
+
+///-----------------------------------------
+/// @name Importing Directories Concurrently
+///-----------------------------------------
+
+/**
+ The maximum number of files that are imported concurrently when importing a directory. Concurrent imports are opt-in.
+
+ Each file in a directory is parsed and mapped on its own worker into a child context of the `managedObjectContext`, and the mapped objects are merged into the `managedObjectContext` by serialized saves of the child contexts. Relationship connections are deferred until `finishImporting:` is invoked, as for files imported one at a time, so relationships may be connected to objects imported from any file. A value of `1` imports the files of a directory one at a time directly into the `managedObjectContext`. Directories are always imported one file at a time when the `batchSize` is non-zero.
+
+ **Default**: `1`
+
+ @warning Objects are identified within each file and against the objects of files that have already been merged. Objects that are described by more than one file may be duplicated if those files are imported concurrently. Only raise the concurrency limit if the files of a directory describe disjoint sets of objects.
+ */
+@property (nonatomic, assign) NSUInteger maxConcurrentFileImportCount;
+
 ///-----------------------------------------------------------------------------
 /// @name Importing Managed Objects
 ///-----------------------------------------------------------------------------
@@ -154,3 +189,24 @@
 - (void)logSeedingInfo;
 
 @end
+
+/**
+ The `RKManagedObjectImporterDelegate` protocol defines methods for observing the progress of an importer.
+ */
+@protocol RKManagedObjectImporterDelegate <NSObject>
+
+@optional
+
+/**
+ Tells the delegate that the importer has saved a batch of objects streamed from a file. Invoked on the thread that is performing the import.
+
+ @param importer The importer performing the import.
+ @param objectCount The number of objects that have been imported from the file so far.
+ @param path The path of the file being imported.
+ @param fractionCompleted The fraction of the file that has been read, between 0 and 1.
+ @param objectsPerSecond The average number of objects imported from the file per second so far.
+ @see `batchSize`
+ */
+- (void)managedObjectImporter:(RKManagedObjectImporter *)importer didImportObjectCount:(NSUInteger)objectCount fromFileAtPath:(NSString *)path fractionCompleted:(double)fractionCompleted objectsPerSecond:(double)objectsPerSecond;
+
+@end
@@ -28,6 +28,7 @@
 #import "RKInMemoryManagedObjectCache.h"
 #import "RKFetchRequestManagedObjectCache.h"
 #import "RKMIMETypeSerialization.h"
+#import "RKMIMETypes.h"
 #import "RKPathUtilities.h"
 #import "RKLog.h"
 
@@ -35,6 +36,248 @@
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitCoreData
 
+static NSUInteger const RKJSONArrayReaderBufferLength = 64 * 1024;
+
+// Flags of the containers on the stack of an `RKJSONArrayReader`
+enum {
+    RKJSONArrayReaderContainerIsObject = 1 << 0,
+    RKJSONArrayReaderContainerExpectsKey = 1 << 1
+};
+
+static BOOL RKJSONByteIsWhitespace(uint8_t byte)
+{
+    return byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r';
+}
+
+/**
+ Reads the elements of an array within a JSON document from an input stream incrementally, so that a document can be imported without holding it or its entire object graph in memory. The array is either the root of the document or is found by a key path of object keys, as used to find the mappable content of the document. Each element is parsed on its own once all of its bytes have been read.
+ */
+@interface RKJSONArrayReader : NSObject {
+    uint8_t _buffer[RKJSONArrayReaderBufferLength];
+    NSUInteger _bufferLength;
+    NSUInteger _bufferOffset;
+    NSUInteger _depth;
+    NSInteger _arrayDepth;
+    BOOL _inString;
+    BOOL _escaped;
+    BOOL _capturingKey;
+    BOOL _capturingElement;
+    NSUInteger _captureStart;
+}
+@property (nonatomic, strong) NSInputStream *inputStream;
+@property (nonatomic, copy) NSArray *keyPathComponents;
+@property (nonatomic, strong) NSMutableData *containers;
+@property (nonatomic, strong) NSMutableArray *keys;
+@property (nonatomic, strong) NSMutableData *capturedData;
+@property (nonatomic, assign, readwrite) unsigned long long bytesRead;
+@property (nonatomic, assign, readwrite) BOOL foundArray;
+@property (nonatomic, assign, readwrite, getter = isFinished) BOOL finished;
+
+- (id)initWithInputStream:(NSInputStream *)inputStream keyPath:(NSString *)keyPath;
+
+// Returns up to the given number of parsed elements, an empty array once the end of the array or document has been reached, or `nil` if an error occurred
+- (NSArray *)readElementsWithMaximumCount:(NSUInteger)maximumCount error:(NSError **)error;
+@end
+
+@implementation RKJSONArrayReader
+
+- (id)initWithInputStream:(NSInputStream *)inputStream keyPath:(NSString *)keyPath
+{
+    self = [super init];
+    if (self) {
+        self.inputStream = inputStream;
+        self.keyPathComponents = keyPath ? [keyPath componentsSeparatedByString:@"."] : @[];
+        self.containers = [NSMutableData data];
+        self.keys = [NSMutableArray array];
+        self.capturedData = [NSMutableData data];
+        _arrayDepth = -1;
+    }
+    return self;
+}
+
+- (void)beginCapture
+{
+    [self.capturedData setLength:0];
+    _captureStart = _bufferOffset;
+}
+
+- (void)appendCapturedBytesToOffset:(NSUInteger)offset
+{
+    [self.capturedData appendBytes:_buffer + _captureStart length:offset - _captureStart];
+    _captureStart = offset;
+}
+
+- (NSString *)capturedKey
+{
+    NSData *keyData = self.capturedData;
+    if (memchr([keyData bytes], '\\', [keyData length]) == NULL) return [[NSString alloc] initWithData:keyData encoding:NSUTF8StringEncoding];
+
+    // Let the JSON parser unescape the key
+    NSMutableData *arrayData = [NSMutableData dataWithBytes:"[\"" length:2];
+    [arrayData appendData:keyData];
+    [arrayData appendBytes:"\"]" length:2];
+    return [[NSJSONSerialization JSONObjectWithData:arrayData options:0 error:nil] lastObject];
+}
+
+// Returns a Boolean value that indicates if an array opened at the current depth would be the array at the key path
+- (BOOL)currentValueIsAtKeyPath
+{
+    if (_depth != [self.keyPathComponents count]) return NO;
+    const uint8_t *containers = [self.containers bytes];
+    for (NSUInteger i = 0; i < _depth; i++) {
+        if (! (containers[i] & RKJSONArrayReaderContainerIsObject)) return NO;
+        if (! [[self.keys objectAtIndex:i] isEqual:[self.keyPathComponents objectAtIndex:i]]) return NO;
+    }
+    return YES;
+}
+
+- (void)pushContainerIsObject:(BOOL)isObject
+{
+    uint8_t flags = isObject ? (RKJSONArrayReaderContainerIsObject | RKJSONArrayReaderContainerExpectsKey) : 0;
+    [self.containers appendBytes:&flags length:1];
+    [self.keys addObject:[NSNull null]];
+    _depth++;
+}
+
+- (void)popContainer
+{
+    _depth--;
+    [self.containers setLength:_depth];
+    [self.keys removeLastObject];
+}
+
+// Scans a byte before the array has been found, tracking the containers and the keys of the document
+- (void)scanByteOutsideArray:(uint8_t)byte
+{
+    uint8_t *flags = _depth ? (uint8_t *)[self.containers mutableBytes] + _depth - 1 : NULL;
+    if (_depth == 0) {
+        // Skip whitespace and a byte order mark preceding the root, which must be the array itself or an object containing it
+        if (RKJSONByteIsWhitespace(byte) || byte >= 0x80) return;
+        if (byte != ([self.keyPathComponents count] ? '{' : '[')) {
+            self.finished = YES;
+            return;
+        }
+    }
+
+    switch (byte) {
+        case '"':
+            _inString = YES;
+            if (flags && (*flags & RKJSONArrayReaderContainerExpectsKey) && _depth <= [self.keyPathComponents count]) {
+                _capturingKey = YES;
+                [self.capturedData setLength:0];
+                _captureStart = _bufferOffset + 1;
+            }
+            break;
+        case ':':
+            if (flags) *flags &= ~RKJSONArrayReaderContainerExpectsKey;
+            break;
+        case ',':
+            if (flags && (*flags & RKJSONArrayReaderContainerIsObject)) {
+                *flags |= RKJSONArrayReaderContainerExpectsKey;
+                [self.keys replaceObjectAtIndex:_depth - 1 withObject:[NSNull null]];
+            }
+            break;
+        case '{':
+            [self pushContainerIsObject:YES];
+            break;
+        case '[':
+            if ([self currentValueIsAtKeyPath]) {
+                self.foundArray = YES;
+                _arrayDepth = _depth + 1;
+            }
+            [self pushContainerIsObject:NO];
+            break;
+        case '}':
+        case ']':
+            [self popContainer];
+            if (_depth == 0) self.finished = YES;
+            break;
+        default:
+            break;
+    }
+}
+
+// Parses the captured element. Strings, numbers, booleans and nulls are not documents on their own, so are parsed as the sole element of an array
+- (id)parseCapturedElement:(NSError **)error
+{
+    uint8_t firstByte = *(const uint8_t *)[self.capturedData bytes];
+    if (firstByte == '{' || firstByte == '[') return [RKMIMETypeSerialization objectFromData:self.capturedData MIMEType:RKMIMETypeJSON error:error];
+
+    NSMutableData *arrayData = [NSMutableData dataWithBytes:"[" length:1];
+    [arrayData appendData:self.capturedData];
+    [arrayData appendBytes:"]" length:1];
+    return [[RKMIMETypeSerialization objectFromData:arrayData MIMEType:RKMIMETypeJSON error:error] lastObject];
+}
+
+- (NSArray *)readElementsWithMaximumCount:(NSUInteger)maximumCount error:(NSError **)error
+{
+    NSMutableArray *elements = [NSMutableArray arrayWithCapacity:maximumCount];
+    while (! self.finished && [elements count] < maximumCount) {
+        if (_bufferOffset == _bufferLength) {
+            if (_capturingKey || _capturingElement) [self appendCapturedBytesToOffset:_bufferLength];
+            if ([self.inputStream streamStatus] == NSStreamStatusNotOpen) [self.inputStream open];
+            NSInteger length = [self.inputStream read:_buffer maxLength:RKJSONArrayReaderBufferLength];
+            if (length < 0) {
+                if (error) *error = [self.inputStream streamError];
+                return nil;
+            }
+            if (length == 0) {
+                if (self.foundArray) {
+                    NSDictionary *userInfo = @{ NSLocalizedDescriptionKey: @"The JSON document ended before the end of the array being imported." };
+                    if (error) *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:userInfo];
+                    return nil;
+                }
+                self.finished = YES;
+                break;
+            }
+            _bufferLength = length;
+            _bufferOffset = 0;
+            _captureStart = 0;
+            self.bytesRead += length;
+        }
+
+        uint8_t byte = _buffer[_bufferOffset];
+        if (_inString) {
+            if (_escaped) {
+                _escaped = NO;
+            } else if (byte == '\\') {
+                _escaped = YES;
+            } else if (byte == '"') {
+                _inString = NO;
+                if (_capturingKey) {
+                    [self appendCapturedBytesToOffset:_bufferOffset];
+                    [self.keys replaceObjectAtIndex:_depth - 1 withObject:[self capturedKey] ?: [NSNull null]];
+                    _capturingKey = NO;
+                }
+            }
+        } else if (_arrayDepth < 0) {
+            [self scanByteOutsideArray:byte];
+        } else if (_depth == (NSUInteger)_arrayDepth && (byte == ',' || byte == ']')) {
+            if (_capturingElement) {
+                [self appendCapturedBytesToOffset:_bufferOffset];
+                _capturingElement = NO;
+                id element = [self parseCapturedElement:error];
+                if (! element) return nil;
+                [elements addObject:element];
+            }
+            if (byte == ']') self.finished = YES;
+        } else if (! RKJSONByteIsWhitespace(byte)) {
+            if (_depth == (NSUInteger)_arrayDepth && ! _capturingElement) {
+                _capturingElement = YES;
+                [self beginCapture];
+            }
+            if (byte == '"') _inString = YES;
+            else if (byte == '{' || byte == '[') _depth++;
+            else if (byte == '}' || byte == ']') _depth--;
+        }
+        _bufferOffset++;
+    }
+
+    return elements;
+}
+
+@end
+
 @interface RKManagedObjectImporter ()
 @property (nonatomic, strong, readwrite) NSManagedObjectModel *managedObjectModel;
 @property (nonatomic, strong, readwrite) NSString *storePath;
@@ -43,6 +286,7 @@
 @property (nonatomic, strong, readwrite) NSManagedObjectContext *managedObjectContext;
 @property (nonatomic, strong, readwrite) RKManagedObjectMappingOperationDataSource *mappingOperationDataSource;
 @property (nonatomic, strong, readwrite) NSOperationQueue *connectionQueue;
+@property (nonatomic, strong) NSMutableArray *childManagedObjectContexts;
 @property (nonatomic, assign) BOOL hasPerformedResetIfNecessary;
 @end
 
@@ -72,6 +316,8 @@
         [self.connectionQueue setSuspended:YES];
         
         self.managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:managedObjectContext];
+        self.childManagedObjectContexts = [NSMutableArray array];
+        self.maxConcurrentFileImportCount = 1;
 
         self.hasPerformedResetIfNecessary = NO;
         self.resetsStoreBeforeImporting = YES;
@@ -101,6 +347,8 @@
         [self.connectionQueue setSuspended:YES];
 
         self.managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:managedObjectContext];
+        self.childManagedObjectContexts = [NSMutableArray array];
+        self.maxConcurrentFileImportCount = 1;
 
         self.hasPerformedResetIfNecessary = NO;
         self.resetsStoreBeforeImporting = NO;
@@ -150,6 +398,7 @@
 - (void)setManagedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache
 {
     NSAssert(self.connectionQueue, @"Connection Queue cannot be nil");
+    _managedObjectCache = managedObjectCache;
     self.mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:self.managedObjectContext
                                                                                                                 cache:managedObjectCache];
     self.mappingOperationDataSource.operationQueue = self.connectionQueue;
@@ -180,6 +429,24 @@
     self.hasPerformedResetIfNecessary = YES;
 }
 
+- (id)objectFromFileAtPath:(NSString *)path error:(NSError **)error
+{
+    NSError *localError = nil;
+    NSData *payload = [NSData dataWithContentsOfFile:path options:0 error:&localError];
+    if (! payload) {
+        RKLogError(@"Failed to read file at path '%@': %@", path, [localError localizedDescription]);
+        if (error) *error = localError;
+        return nil;
+    }
+
+    id parsedData = [RKMIMETypeSerialization objectFromData:payload MIMEType:RKMIMETypeFromPathExtension(path) error:&localError];
+    if (! parsedData) {
+        RKLogError(@"Failed to parse file at path '%@': %@", path, [localError localizedDescription]);
+        if (error) *error = localError;
+    }
+    return parsedData;
+}
+
 - (NSUInteger)importObjectsFromFileAtPath:(NSString *)path withMapping:(RKMapping *)mapping keyPath:(NSString *)keyPath error:(NSError **)error
 {
     NSParameterAssert(path);
@@ -188,20 +455,15 @@
     // Perform the reset on the first import action if requested
     [self resetPersistentStoreIfNecessary];
 
-    __block NSError *localError = nil;
-    NSData *payload = [NSData dataWithContentsOfFile:path options:0 error:&localError];
-    if (! payload) {
-        RKLogError(@"Failed to read file at path '%@': %@", path, [localError localizedDescription]);
-        if (error) *error = localError;
-        return NSNotFound;
+    if (self.batchSize && [RKMIMETypeFromPathExtension(path) isEqualToString:RKMIMETypeJSON]) {
+        BOOL foundArray = NO;
+        NSUInteger objectCount = [self importObjectsByStreamingJSONFileAtPath:path withMapping:mapping keyPath:keyPath foundArray:&foundArray error:error];
+        if (foundArray || objectCount == NSNotFound) return objectCount;
+        RKLogDebug(@"Content of file at path '%@' is not an array: importing it without streaming", path);
     }
 
-    NSString *MIMEType = RKMIMETypeFromPathExtension(path);
-    id parsedData = [RKMIMETypeSerialization objectFromData:payload MIMEType:MIMEType error:&localError];
-    if (!parsedData) {
-        RKLogError(@"Failed to parse file at path '%@': %@", path, [localError localizedDescription]);
-    }
-    
+    __block NSError *localError = nil;
+    id parsedData = [self objectFromFileAtPath:path error:&localError];
     if (! parsedData) {
         if (error) *error = localError;
         return NSNotFound;
@@ -227,6 +489,197 @@
     return objectCount;
 }
 
+/*
+ Performs the connection operations that have been deferred until importing is finished, then saves the child contexts of files imported concurrently to merge the relationships connected in them into the importer's context. The connection queue is suspended again afterwards so that files imported later continue to defer their connections.
+ */
+- (BOOL)performDeferredConnectionOperations:(NSError **)error
+{
+    RKLogInfo(@"Starting %lu connection operations...", (unsigned long) self.connectionQueue.operationCount);
+    [self.connectionQueue setMaxConcurrentOperationCount:50];
+    [self.connectionQueue setSuspended:NO];
+    [self.connectionQueue waitUntilAllOperationsAreFinished];
+    [self.connectionQueue setSuspended:YES];
+
+    // Merge the relationships connected in the child contexts of files imported concurrently
+    __block BOOL success = YES;
+    __block NSError *localError = nil;
+    for (NSManagedObjectContext *childContext in self.childManagedObjectContexts) {
+        [childContext performBlockAndWait:^{
+            success = [childContext save:&localError];
+            if (! success) {
+                RKLogCoreDataError(localError);
+            }
+        }];
+        if (! success) {
+            if (error) *error = localError;
+            return NO;
+        }
+    }
+    [self.childManagedObjectContexts removeAllObjects];
+    return YES;
+}
+
+/*
+ Maps the given representations and connects their relationships, then saves and resets the managed object context so that the memory used by the batch is released before the next one is read. Objects of earlier batches are identified through the managed object cache.
+ */
+- (NSUInteger)importBatchOfRepresentations:(NSArray *)representations withMapping:(RKMapping *)mapping error:(NSError **)error
+{
+    NSOperationQueue *connectionQueue = [NSOperationQueue new];
+    [connectionQueue setName:@"RKManagedObjectImporter Batch Connection Queue"];
+    [connectionQueue setSuspended:YES];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:self.managedObjectContext
+                                                                                                                                                      cache:self.managedObjectCache];
+    mappingOperationDataSource.operationQueue = connectionQueue;
+
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: mapping }];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    mappingOperationDataSource.parentOperation = mapper;
+    __block RKMappingResult *mappingResult;
+    __block NSError *localError = nil;
+    [self.managedObjectContext performBlockAndWait:^{
+        [mapper start];
+        mappingResult = mapper.mappingResult;
+        localError = mapper.error;
+    }];
+    [connectionQueue setSuspended:NO];
+    [connectionQueue waitUntilAllOperationsAreFinished];
+    if (mappingResult == nil) {
+        if (error) *error = localError;
+        return NSNotFound;
+    }
+
+    __block BOOL success;
+    [self.managedObjectContext performBlockAndWait:^{
+        success = [self.managedObjectContext save:&localError];
+        if (success) {
+            [self.managedObjectContext reset];
+        } else {
+            RKLogCoreDataError(localError);
+        }
+    }];
+    if (! success) {
+        if (error) *error = localError;
+        return NSNotFound;
+    }
+    return [mappingResult count];
+}
+
+- (NSUInteger)importObjectsByStreamingJSONFileAtPath:(NSString *)path withMapping:(RKMapping *)mapping keyPath:(NSString *)keyPath foundArray:(BOOL *)foundArray error:(NSError **)error
+{
+    // Resetting the context after each batch would discard the objects of files imported earlier before their deferred relationships are connected
+    if (self.connectionQueue.operationCount || [self.childManagedObjectContexts count]) {
+        *foundArray = NO;
+        if (! [self performDeferredConnectionOperations:error]) return NSNotFound;
+    }
+
+    NSInputStream *inputStream = [NSInputStream inputStreamWithFileAtPath:path];
+    RKJSONArrayReader *reader = [[RKJSONArrayReader alloc] initWithInputStream:inputStream keyPath:keyPath];
+    unsigned long long fileSize = [[[NSFileManager defaultManager] attributesOfItemAtPath:path error:nil] fileSize];
+    NSDate *startDate = [NSDate date];
+    NSUInteger objectCount = 0;
+    NSError *localError = nil;
+    BOOL success = YES;
+
+    while (success) {
+        @autoreleasepool {
+            NSArray *representations = [reader readElementsWithMaximumCount:self.batchSize error:&localError];
+            if (! representations) {
+                RKLogError(@"Failed to parse file at path '%@': %@", path, [localError localizedDescription]);
+                success = NO;
+            } else if ([representations count] == 0) {
+                break;
+            } else {
+                NSUInteger batchObjectCount = [self importBatchOfRepresentations:representations withMapping:mapping error:&localError];
+                if (batchObjectCount == NSNotFound) {
+                    RKLogError(@"Importing file at path '%@' failed with error: %@", path, localError);
+                    success = NO;
+                    break;
+                }
+                objectCount += batchObjectCount;
+                NSTimeInterval elapsedTime = -[startDate timeIntervalSinceNow];
+                RKLogDebug(@"Imported %lu objects from file at path '%@' (%llu of %llu bytes read)", (unsigned long)objectCount, path, reader.bytesRead, fileSize);
+                if ([self.delegate respondsToSelector:@selector(managedObjectImporter:didImportObjectCount:fromFileAtPath:fractionCompleted:objectsPerSecond:)]) {
+                    [self.delegate managedObjectImporter:self
+                                    didImportObjectCount:objectCount
+                                          fromFileAtPath:path
+                                       fractionCompleted:fileSize ? MIN(1.0, (double)reader.bytesRead / fileSize) : 1.0
+                                        objectsPerSecond:elapsedTime > 0 ? objectCount / elapsedTime : 0];
+                }
+            }
+        }
+    }
+    [inputStream close];
+
+    *foundArray = reader.foundArray;
+    if (! success) {
+        if (error) *error = localError;
+        return NSNotFound;
+    }
+    if (reader.foundArray) RKLogInfo(@"Imported %lu objects from file at path '%@' in batches of %lu", (unsigned long)objectCount, path, (unsigned long)self.batchSize);
+    return objectCount;
+}
+
+/*
+ Imports the file at the given path into a new child context of the importer's context. Parsing and mapping are performed
+ independently of other files, and the mapped objects are then merged into the importer's context by saving the child context.
+ The connection operations of the child context are enqueued on the connection queue so that, as for files imported serially,
+ relationships are connected when importing is finished. The child context is therefore retained until then.
+ */
+- (NSUInteger)importObjectsFromFileAtPathInChildContext:(NSString *)path withMapping:(RKMapping *)mapping keyPath:(NSString *)keyPath error:(NSError **)error
+{
+    NSError *localError = nil;
+    id parsedData = [self objectFromFileAtPath:path error:&localError];
+    if (! parsedData) {
+        if (error) *error = localError;
+        return NSNotFound;
+    }
+
+    NSManagedObjectContext *childContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    [childContext performBlockAndWait:^{
+        childContext.parentContext = self.managedObjectContext;
+        childContext.mergePolicy = NSMergeByPropertyObjectTrumpMergePolicy;
+    }];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:childContext
+                                                                                                                                                      cache:self.managedObjectCache];
+    mappingOperationDataSource.operationQueue = self.connectionQueue;
+
+    NSDictionary *mappingDictionary = @{ (keyPath ?: [NSNull null]) : mapping };
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:parsedData mappingsDictionary:mappingDictionary];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    mappingOperationDataSource.parentOperation = mapper;
+    __block RKMappingResult *mappingResult;
+    __block NSError *blockError = nil;
+    [childContext performBlockAndWait:^{
+        [mapper start];
+        mappingResult = mapper.mappingResult;
+        blockError = mapper.error;
+    }];
+    if (mappingResult == nil) {
+        RKLogError(@"Importing file at path '%@' failed with error: %@", path, blockError);
+        if (error) *error = blockError;
+        return NSNotFound;
+    }
+
+    // Saves are serialized so that the objects of one file are merged into the importer's context at a time. Permanent IDs make the objects addressable by the managed object cache from sibling contexts.
+    __block BOOL success;
+    @synchronized(self.childManagedObjectContexts) {
+        [childContext performBlockAndWait:^{
+            success = [childContext obtainPermanentIDsForObjects:[[childContext insertedObjects] allObjects] error:&blockError];
+            if (success) success = [childContext save:&blockError];
+            if (! success) RKLogCoreDataError(blockError);
+        }];
+        if (success) [self.childManagedObjectContexts addObject:childContext];
+    }
+    if (! success) {
+        if (error) *error = blockError;
+        return NSNotFound;
+    }
+
+    NSUInteger objectCount = [mappingResult count];
+    RKLogInfo(@"Imported %lu objects from file at path '%@'", (unsigned long)objectCount, path);
+    return objectCount;
+}
+
 - (NSUInteger)importObjectsFromDirectoryAtPath:(NSString *)path withMapping:(RKMapping *)mapping keyPath:(NSString *)keyPath error:(NSError **)error
 {
     NSError *localError = nil;
@@ -237,18 +690,66 @@
         return NSNotFound;
     }
 
+    // Files are imported in the order of their names, so that imports of a directory are repeatable
+    NSMutableArray *filePaths = [NSMutableArray arrayWithCapacity:[entries count]];
+    for (NSString *entry in [entries sortedArrayUsingSelector:@selector(compare:)]) {
+        BOOL isDirectory = NO;
+        NSString *filePath = [path stringByAppendingPathComponent:entry];
+        if ([entry hasPrefix:@"."] || ! [[NSFileManager defaultManager] fileExistsAtPath:filePath isDirectory:&isDirectory] || isDirectory) {
+            RKLogDebug(@"Skipping directory entry '%@' that is not a file to import", filePath);
+            continue;
+        }
+        [filePaths addObject:filePath];
+    }
+
+    // Streamed files bound their memory use by saving and resetting the importer's context, so are imported one at a time
     NSUInteger aggregateObjectCount = 0;
-    for (NSString *entry in entries) {
-        NSUInteger objectCount = [self importObjectsFromFileAtPath:path withMapping:mapping keyPath:keyPath error:&localError];
-        if (objectCount == NSNotFound) {
-            if (error) *error = localError;
-            return NSNotFound;
-        } else {
-            aggregateObjectCount += objectCount;
+    if (self.batchSize || self.maxConcurrentFileImportCount <= 1 || [filePaths count] <= 1) {
+        for (NSString *filePath in filePaths) {
+            NSUInteger objectCount = [self importObjectsFromFileAtPath:filePath withMapping:mapping keyPath:keyPath error:&localError];
+            if (objectCount == NSNotFound) {
+                if (error) *error = localError;
+                return NSNotFound;
+            } else {
+                aggregateObjectCount += objectCount;
+            }
         }
+
+        return aggregateObjectCount;
     }
 
-    return aggregateObjectCount;
+    [self resetPersistentStoreIfNecessary];
+
+    NSOperationQueue *importQueue = [NSOperationQueue new];
+    [importQueue setName:@"RKManagedObjectImporter Import Queue"];
+    [importQueue setMaxConcurrentOperationCount:self.maxConcurrentFileImportCount];
+    __block NSError *importError = nil;
+    __block NSUInteger importedObjectCount = 0;
+    RKLogInfo(@"Importing %lu files from directory at path '%@' with up to %lu concurrent imports...", (unsigned long)[filePaths count], path, (unsigned long)self.maxConcurrentFileImportCount);
+    for (NSString *filePath in filePaths) {
+        [importQueue addOperationWithBlock:^{
+            @autoreleasepool {
+                NSError *fileError = nil;
+                NSUInteger objectCount = [self importObjectsFromFileAtPathInChildContext:filePath withMapping:mapping keyPath:keyPath error:&fileError];
+                @synchronized(importQueue) {
+                    if (objectCount == NSNotFound) {
+                        if (! importError) importError = fileError;
+                        [importQueue cancelAllOperations];
+                    } else {
+                        importedObjectCount += objectCount;
+                    }
+                }
+            }
+        }];
+    }
+    [importQueue waitUntilAllOperationsAreFinished];
+
+    if (importError) {
+        if (error) *error = importError;
+        return NSNotFound;
+    }
+
+    return importedObjectCount;
 }
 
 - (NSUInteger)importObjectsFromItemAtPath:(NSString *)path withMapping:(RKMapping *)mapping keyPath:(NSString *)keyPath error:(NSError **)error
@@ -268,10 +769,7 @@
 - (BOOL)finishImporting:(NSError **)error
 {
     // Perform our connection operations in a batch, before we save the MOC
-    RKLogInfo(@"Starting %lu connection operations...", (unsigned long) self.connectionQueue.operationCount);
-    [self.connectionQueue setMaxConcurrentOperationCount:50];
-    [self.connectionQueue setSuspended:NO];
-    [self.connectionQueue waitUntilAllOperationsAreFinished];
+    if (! [self performDeferredConnectionOperations:error]) return NO;
 
     __block BOOL success;
     __block NSError *localError = nil;
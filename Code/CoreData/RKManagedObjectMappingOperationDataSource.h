@@ -69,6 +69,8 @@
  The parent operation upon which instances of `RKRelationshipConnectionOperation` created by the data source are dependent upon.
  
  When connecting relationships as part of a managed object mapping operation, it is possible that the mapping operation itself will create managed objects that should be used to satisfy the connections mappings of representations being mapped. To support such cases, is is desirable to defer the execution of connection operations until the execution of the aggregate mapping operation is complete. The `parentOperation` property provides support for deferring the execution of the enqueued relationship connection operations by establishing a dependency between the connection operations and a parent operation, such as an instance of `RKMapperOperation` such that they will not be executed by the `operationQueue` until the parent operation has finished executing.
+
+ When a parent operation is set, the data source does not create an `RKRelationshipConnectionOperation` for each mapped object. Instead, the relationships of every object mapped by the parent operation are connected by a single operation, which looks up the destination objects of each connection for all objects of an entity mapping with one request to the managed object cache and assigns the relationships within one block of the managed object context.
  */
 @property (nonatomic, weak) NSOperation *parentOperation;
 
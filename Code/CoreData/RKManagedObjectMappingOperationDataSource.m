@@ -28,6 +28,7 @@
 #import "RKObjectMappingMatcher.h"
 #import "RKManagedObjectCaching.h"
 #import "RKRelationshipConnectionOperation.h"
+#import "RKConnectionDescription.h"
 #import "RKMappingErrors.h"
 #import "RKValueTransformers.h"
 #import "RKRelationshipMapping.h"
@@ -36,9 +37,18 @@
 
 extern NSString * const RKObjectMappingNestingAttributeKeyName;
 
+@interface RKObjectMapping ()
+- (RKAttributeMapping *)mappingForAttribute:(NSString *)attributeKey;
+@end
+
 static void *RKManagedObjectMappingOperationDataSourceAssociatedObjectKey = &RKManagedObjectMappingOperationDataSourceAssociatedObjectKey;
+static void *RKRelationshipConnectionBatchOperationAssociatedObjectKey = &RKRelationshipConnectionBatchOperationAssociatedObjectKey;
 
 NSArray *RKApplyNestingAttributeValueToMappings(NSString *attributeName, id value, NSArray *propertyMappings);
+NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescription *connection, NSManagedObject *managedObject);
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects);
+NSDictionary *RKManagedObjectsByConnectionAttributeValues(id<RKManagedObjectCaching> managedObjectCache, NSEntityDescription *entity, NSArray *attributeValuesCollection, NSManagedObjectContext *managedObjectContext);
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result);
 
 static id RKValueForAttributeMappingInRepresentation(RKAttributeMapping *attributeMapping, NSDictionary *representation)
 {
@@ -51,13 +61,17 @@ static id RKValueForAttributeMappingInRepresentation(RKAttributeMapping *attribu
     }
 }
 
-static RKAttributeMapping *RKAttributeMappingForNameInMappings(NSString *name, NSArray *attributeMappings)
+// Indexes the given attribute mappings by destination key path, keeping the first mapping for each key path
+static NSDictionary *RKAttributeMappingsByDestinationKeyPath(NSArray *attributeMappings)
 {
+    NSMutableDictionary *attributeMappingsByDestinationKeyPath = [NSMutableDictionary dictionaryWithCapacity:[attributeMappings count]];
     for (RKAttributeMapping *attributeMapping in attributeMappings) {
-        if ([[attributeMapping destinationKeyPath] isEqualToString:name]) return attributeMapping;
+        if (attributeMapping.destinationKeyPath && ! [attributeMappingsByDestinationKeyPath objectForKey:attributeMapping.destinationKeyPath]) {
+            [attributeMappingsByDestinationKeyPath setObject:attributeMapping forKey:attributeMapping.destinationKeyPath];
+        }
     }
     
-    return nil;
+    return attributeMappingsByDestinationKeyPath;
 }
 
 /**
@@ -67,22 +81,23 @@ static NSDictionary *RKEntityIdentificationAttributesForEntityMappingWithReprese
 {
     NSCParameterAssert(entityMapping);
     NSCAssert([representation isKindOfClass:[NSDictionary class]], @"Expected a dictionary representation");
-    NSArray *attributeMappings = entityMapping.attributeMappings;
     __block NSError *error = nil;
 
     // If the representation is mapped with a nesting attribute, we must apply the nesting value to the representation before constructing the identification attributes
+    NSDictionary *nestedAttributeMappingsByDestinationKeyPath = nil;
     RKAttributeMapping *nestingAttributeMapping = [[entityMapping propertyMappingsBySourceKeyPath] objectForKey:RKObjectMappingNestingAttributeKeyName];
     if (nestingAttributeMapping) {
         Class attributeClass = [entityMapping classForProperty:nestingAttributeMapping.destinationKeyPath];
         id attributeValue = nil;
         [entityMapping.valueTransformer transformValue:[[representation allKeys] lastObject] toValue:&attributeValue ofClass:attributeClass error:&error];
-        attributeMappings = RKApplyNestingAttributeValueToMappings(nestingAttributeMapping.destinationKeyPath, attributeValue, attributeMappings);
+        NSArray *nestedAttributeMappings = RKApplyNestingAttributeValueToMappings(nestingAttributeMapping.destinationKeyPath, attributeValue, entityMapping.attributeMappings);
+        nestedAttributeMappingsByDestinationKeyPath = RKAttributeMappingsByDestinationKeyPath(nestedAttributeMappings);
     }
     
     // Map the identification attributes
     NSMutableDictionary *entityIdentifierAttributes = [NSMutableDictionary dictionaryWithCapacity:[entityMapping.identificationAttributes count]];
     [entityMapping.identificationAttributes enumerateObjectsUsingBlock:^(NSAttributeDescription *attribute, NSUInteger idx, BOOL *stop) {
-        RKAttributeMapping *attributeMapping = RKAttributeMappingForNameInMappings([attribute name], attributeMappings);
+        RKAttributeMapping *attributeMapping = nestedAttributeMappingsByDestinationKeyPath ? [nestedAttributeMappingsByDestinationKeyPath objectForKey:[attribute name]] : [entityMapping mappingForAttribute:[attribute name]];
         Class attributeClass = [entityMapping classForProperty:[attribute name]];
         id sourceValue = RKValueForAttributeMappingInRepresentation(attributeMapping, representation);
         id attributeValue = nil;
@@ -180,12 +195,148 @@ static BOOL RKDeleteInvalidNewManagedObject(NSManagedObject *managedObject)
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitCoreData
 
+/**
+ Connects the relationships of every object mapped by a parent operation in a single pass once the parent operation has finished, rather than with an `RKRelationshipConnectionOperation` per object. The objects are grouped by entity mapping, and the destination objects of each foreign key connection are looked up for all objects of the group at once. Invalid new objects are then discarded for entity mappings that request it, once every connection has been established.
+ */
+@interface RKRelationshipConnectionBatchOperation : NSOperation
+
+- (id)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache;
+- (void)addMappingOperation:(RKMappingOperation *)mappingOperation;
+@end
+
+@interface RKRelationshipConnectionBatchOperation ()
+@property (nonatomic, weak) NSManagedObjectContext *managedObjectContext;
+@property (nonatomic, strong) id<RKManagedObjectCaching> managedObjectCache;
+@property (nonatomic, strong) NSMutableArray *entityMappings;
+@property (nonatomic, strong) NSMutableDictionary *mappingOperationsByEntityMapping;
+@end
+
+@implementation RKRelationshipConnectionBatchOperation
+
+- (id)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache
+{
+    self = [self init];
+    if (self) {
+        self.managedObjectContext = managedObjectContext;
+        self.managedObjectCache = managedObjectCache;
+        self.entityMappings = [NSMutableArray new];
+        self.mappingOperationsByEntityMapping = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)addMappingOperation:(RKMappingOperation *)mappingOperation
+{
+    RKEntityMapping *entityMapping = (RKEntityMapping *)mappingOperation.objectMapping;
+    NSValue *entityMappingKey = [NSValue valueWithNonretainedObject:entityMapping];
+    @synchronized(self) {
+        NSMutableArray *mappingOperations = [self.mappingOperationsByEntityMapping objectForKey:entityMappingKey];
+        if (! mappingOperations) {
+            mappingOperations = [NSMutableArray array];
+            [self.mappingOperationsByEntityMapping setObject:mappingOperations forKey:entityMappingKey];
+            [self.entityMappings addObject:entityMapping];
+        }
+        [mappingOperations addObject:mappingOperation];
+    }
+}
+
+- (void)connectRelationshipWithConnection:(RKConnectionDescription *)connection forMappingOperations:(NSArray *)mappingOperations
+{
+    // Collect the attribute values of every object that can be connected, which are `[NSNull null]` for objects failing the source predicate as their relationship is cleared
+    NSMutableArray *connectableMappingOperations = [NSMutableArray arrayWithCapacity:[mappingOperations count]];
+    NSMutableArray *connectionAttributeValues = [NSMutableArray arrayWithCapacity:[mappingOperations count]];
+    NSMutableOrderedSet *attributeValuesCollection = [NSMutableOrderedSet orderedSetWithCapacity:[mappingOperations count]];
+    for (RKMappingOperation *mappingOperation in mappingOperations) {
+        NSManagedObject *managedObject = mappingOperation.destinationObject;
+        if ([managedObject isDeleted] || [managedObject managedObjectContext] == nil) continue;
+        id attributeValues = [NSNull null];
+        if (! connection.sourcePredicate || [connection.sourcePredicate evaluateWithObject:managedObject]) {
+            if ([connection isForeignKeyConnection]) {
+                attributeValues = RKConnectionAttributeValuesWithObject(connection, managedObject);
+                if (! attributeValues) continue;
+                [attributeValuesCollection addObject:attributeValues];
+            } else if (! [connection isKeyPathConnection]) {
+                @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                               reason:[NSString stringWithFormat:@"%@ Attempted to establish a relationship using a mapping that"
+                                                       " specifies neither a foreign key or a key path connection: %@",
+                                                       NSStringFromClass([self class]), connection]
+                                             userInfo:nil];
+            }
+        }
+        [connectableMappingOperations addObject:mappingOperation];
+        [connectionAttributeValues addObject:attributeValues];
+    }
+
+    NSDictionary *managedObjectsByAttributeValues = nil;
+    if ([attributeValuesCollection count]) {
+        managedObjectsByAttributeValues = RKManagedObjectsByConnectionAttributeValues(self.managedObjectCache, [connection.relationship destinationEntity], [attributeValuesCollection array], self.managedObjectContext);
+        RKLogDebug(@"Looked up destination objects of relationship '%@' for %ld attribute value dictionaries of %ld objects", connection.relationship.name, (long)[attributeValuesCollection count], (long)[connectableMappingOperations count]);
+    }
+
+    NSString *relationshipName = connection.relationship.name;
+    [connectableMappingOperations enumerateObjectsUsingBlock:^(RKMappingOperation *mappingOperation, NSUInteger idx, BOOL *stop) {
+        NSManagedObject *managedObject = mappingOperation.destinationObject;
+        id attributeValues = [connectionAttributeValues objectAtIndex:idx];
+        id connectedValue = nil;
+        if (attributeValues != [NSNull null]) {
+            id connectionResult = [connection isForeignKeyConnection] ? RKConnectionResultWithManagedObjects(connection, [managedObjectsByAttributeValues objectForKey:attributeValues]) : [managedObject valueForKeyPath:connection.keyPath];
+            connectedValue = RKRelationshipValueForConnectionResult(connection, connectionResult);
+        }
+
+        @try {
+            [managedObject setValue:connectedValue forKeyPath:relationshipName];
+            RKLogTrace(@"Connected relationship '%@' to object '%@'", relationshipName, connectedValue);
+            if (connectedValue) {
+                if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didConnectRelationship:toValue:usingConnection:)]) {
+                    [mappingOperation.delegate mappingOperation:mappingOperation didConnectRelationship:connection.relationship toValue:connectedValue usingConnection:connection];
+                }
+            } else {
+                if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didFailToConnectRelationship:usingConnection:)]) {
+                    [mappingOperation.delegate mappingOperation:mappingOperation didFailToConnectRelationship:connection.relationship usingConnection:connection];
+                }
+            }
+        }
+        @catch (NSException *exception) {
+            if ([[exception name] isEqualToString:NSObjectInaccessibleException]) {
+                // Object has been deleted
+                RKLogDebug(@"Rescued an `NSObjectInaccessibleException` exception while attempting to establish a relationship.");
+            } else {
+                [exception raise];
+            }
+        }
+    }];
+}
+
+- (void)main
+{
+    [self.managedObjectContext performBlockAndWait:^{
+        for (RKEntityMapping *entityMapping in self.entityMappings) {
+            NSArray *mappingOperations = [self.mappingOperationsByEntityMapping objectForKey:[NSValue valueWithNonretainedObject:entityMapping]];
+            for (RKConnectionDescription *connection in entityMapping.connections) {
+                if (self.isCancelled) return;
+                [self connectRelationshipWithConnection:connection forMappingOperations:mappingOperations];
+            }
+        }
+
+        // The validity of an object may depend on relationships connected from another entity by way of an inverse relationship
+        for (RKEntityMapping *entityMapping in self.entityMappings) {
+            if (! entityMapping.discardsInvalidObjectsOnInsert) continue;
+            for (RKMappingOperation *mappingOperation in [self.mappingOperationsByEntityMapping objectForKey:[NSValue valueWithNonretainedObject:entityMapping]]) {
+                RKDeleteInvalidNewManagedObject(mappingOperation.destinationObject);
+            }
+        }
+    }];
+}
+
+@end
+
 extern NSString * const RKObjectMappingNestingAttributeKeyName;
 
 @interface RKManagedObjectMappingOperationDataSource ()
 @property (nonatomic, strong, readwrite) NSManagedObjectContext *managedObjectContext;
 @property (nonatomic, strong, readwrite) id<RKManagedObjectCaching> managedObjectCache;
 @property (nonatomic, strong) NSMutableArray *deletionPredicates;
+@property (nonatomic, strong) NSMutableDictionary *preparedManagedObjectsByEntityName;
 @end
 
 @implementation RKManagedObjectMappingOperationDataSource
@@ -254,10 +405,20 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
     }
     
     // If we have found the entity identification attributes, try to find an existing instance to update
+    NSMutableDictionary *preparedManagedObjects = [self.preparedManagedObjectsByEntityName objectForKey:[entity name]];
     if ([entityIdentifierAttributes count]) {
-        NSSet *objects = [self.managedObjectCache managedObjectsWithEntity:entity
-                                                           attributeValues:entityIdentifierAttributes
-                                                    inManagedObjectContext:self.managedObjectContext];
+        NSSet *objects = [preparedManagedObjects objectForKey:entityIdentifierAttributes];
+        for (NSManagedObject *preparedObject in objects) {
+            if ([preparedObject isDeleted]) {
+                objects = nil;
+                break;
+            }
+        }
+        if (! objects) {
+            objects = [self.managedObjectCache managedObjectsWithEntity:entity
+                                                        attributeValues:entityIdentifierAttributes
+                                                 inManagedObjectContext:self.managedObjectContext];
+        }
         if (entityMapping.identificationPredicate) objects = [objects filteredSetUsingPredicate:entityMapping.identificationPredicate];
         if ([objects count] > 0) {
             managedObject = [objects anyObject];
@@ -276,11 +437,50 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
         if ([self.managedObjectCache respondsToSelector:@selector(didCreateObject:)]) {
             [self.managedObjectCache didCreateObject:managedObject];
         }
+
+        // Ensure that a later representation in the prepared collection with the same identification attributes finds the new object
+        if ([preparedManagedObjects objectForKey:entityIdentifierAttributes]) {
+            [preparedManagedObjects setObject:[NSSet setWithObject:managedObject] forKey:entityIdentifierAttributes];
+        }
     }
 
     return managedObject;
 }
 
+- (void)prepareTargetObjectsForRepresentations:(NSArray *)representations withMapping:(RKMapping *)mapping
+{
+    if (! [mapping isKindOfClass:[RKEntityMapping class]]) return;
+    if (! [self.managedObjectCache respondsToSelector:@selector(managedObjectsWithEntity:attributeValuesCollection:inManagedObjectContext:)]) return;
+    RKEntityMapping *entityMapping = (RKEntityMapping *)mapping;
+    if ([entityMapping.identificationAttributes count] == 0) return;
+
+    NSMutableOrderedSet *attributeValuesCollection = [NSMutableOrderedSet orderedSetWithCapacity:[representations count]];
+    for (NSDictionary *representation in representations) {
+        if (! [representation isKindOfClass:[NSDictionary class]]) continue;
+        [attributeValuesCollection addObject:RKEntityIdentificationAttributesForEntityMappingWithRepresentation(entityMapping, representation)];
+    }
+    if ([attributeValuesCollection count] == 0) return;
+
+    NSEntityDescription *entity = [entityMapping entity];
+    NSDictionary *managedObjectsByAttributeValues = [self.managedObjectCache managedObjectsWithEntity:entity
+                                                                          attributeValuesCollection:[attributeValuesCollection array]
+                                                                             inManagedObjectContext:self.managedObjectContext];
+    RKLogDebug(@"Prepared %ld target objects of Entity '%@' for %ld representations", (long)[managedObjectsByAttributeValues count], [entity name], (long)[representations count]);
+    if (! self.preparedManagedObjectsByEntityName) self.preparedManagedObjectsByEntityName = [NSMutableDictionary dictionary];
+    NSMutableDictionary *preparedManagedObjects = [self.preparedManagedObjectsByEntityName objectForKey:[entity name]];
+    if (preparedManagedObjects) {
+        [preparedManagedObjects addEntriesFromDictionary:managedObjectsByAttributeValues];
+    } else {
+        [self.preparedManagedObjectsByEntityName setObject:[managedObjectsByAttributeValues mutableCopy] forKey:[entity name]];
+    }
+}
+
+- (void)didMapRepresentations:(NSArray *)representations withMapping:(RKMapping *)mapping
+{
+    if (! [mapping isKindOfClass:[RKEntityMapping class]]) return;
+    [self.preparedManagedObjectsByEntityName removeObjectForKey:[[(RKEntityMapping *)mapping entity] name]];
+}
+
 // Mapping operations should be executed against managed object contexts with the `NSPrivateQueueConcurrencyType` concurrency type
 - (BOOL)executingConnectionOperationsWouldDeadlock
 {
@@ -311,45 +511,61 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
             return NO;
         }
         
-        /**
-         Attempt to establish the connections and delete the object if its invalid once we are done
-         
-         NOTE: We obtain a weak reference to the MOC to avoid a potential crash under iOS 5 if the MOC is deallocated before the operation executes. Under iOS 6, the object returns a nil `managedObjectContext` and the `performBlockAndWait:` message is sent to nil.
-         */
         NSOperationQueue *operationQueue = self.operationQueue ?: [NSOperationQueue currentQueue];
-        __weak NSManagedObjectContext *weakContext = [(NSManagedObject *)mappingOperation.destinationObject managedObjectContext];
-        NSBlockOperation *deletionOperation = entityMapping.discardsInvalidObjectsOnInsert ? [NSBlockOperation blockOperationWithBlock:^{
-            [weakContext performBlockAndWait:^{
-                RKDeleteInvalidNewManagedObject(mappingOperation.destinationObject);
-            }];
-        }] : nil;
-        
-        // Add a dependency on the parent operation. If we are being mapped as part of a relationship, then the assignment of the mapped object to a parent may well fulfill the validation requirements. This ensures that the relationship mapping has completed before we evaluate the object for deletion.
-        if (self.parentOperation) [deletionOperation addDependency:self.parentOperation];
-
-        RKRelationshipConnectionOperation *connectionOperation = nil;
-        if ([connections count]) {
-            connectionOperation = [[RKRelationshipConnectionOperation alloc] initWithManagedObject:mappingOperation.destinationObject connections:connections managedObjectCache:self.managedObjectCache];
-            [connectionOperation setConnectionBlock:^(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue) {
-                if (connectedValue) {
-                    if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didConnectRelationship:toValue:usingConnection:)]) {
-                        [mappingOperation.delegate mappingOperation:mappingOperation didConnectRelationship:connection.relationship toValue:connectedValue usingConnection:connection];
-                    }
-                } else {
-                    if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didFailToConnectRelationship:usingConnection:)]) {
-                        [mappingOperation.delegate mappingOperation:mappingOperation didFailToConnectRelationship:connection.relationship usingConnection:connection];
+        NSOperation *connectionOperation = nil;
+        if (self.parentOperation) {
+            /**
+             Defer the connections and the deletion of invalid objects until the parent operation has finished, and perform them for every object it mapped in a single batched pass
+             */
+            connectionOperation = objc_getAssociatedObject(self.parentOperation, RKRelationshipConnectionBatchOperationAssociatedObjectKey);
+            if (! connectionOperation && ([connections count] || entityMapping.discardsInvalidObjectsOnInsert)) {
+                connectionOperation = [[RKRelationshipConnectionBatchOperation alloc] initWithManagedObjectContext:[(NSManagedObject *)mappingOperation.destinationObject managedObjectContext] managedObjectCache:self.managedObjectCache];
+                objc_setAssociatedObject(self.parentOperation, RKRelationshipConnectionBatchOperationAssociatedObjectKey, connectionOperation, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+                [connectionOperation addDependency:self.parentOperation];
+
+                // Ensure an existing predicate deletion executes after the connections have been established
+                [(NSOperation *)objc_getAssociatedObject(self.parentOperation, RKManagedObjectMappingOperationDataSourceAssociatedObjectKey) addDependency:connectionOperation];
+
+                [operationQueue addOperation:connectionOperation];
+                RKLogTrace(@"Enqueued %@ dependent upon parent operation %@ to operation queue %@", connectionOperation, self.parentOperation, operationQueue);
+            }
+            if ([connections count] || entityMapping.discardsInvalidObjectsOnInsert) [(RKRelationshipConnectionBatchOperation *)connectionOperation addMappingOperation:mappingOperation];
+        } else {
+            /**
+             Attempt to establish the connections and delete the object if its invalid once we are done
+             
+             NOTE: We obtain a weak reference to the MOC to avoid a potential crash under iOS 5 if the MOC is deallocated before the operation executes. Under iOS 6, the object returns a nil `managedObjectContext` and the `performBlockAndWait:` message is sent to nil.
+             */
+            __weak NSManagedObjectContext *weakContext = [(NSManagedObject *)mappingOperation.destinationObject managedObjectContext];
+            NSBlockOperation *deletionOperation = entityMapping.discardsInvalidObjectsOnInsert ? [NSBlockOperation blockOperationWithBlock:^{
+                [weakContext performBlockAndWait:^{
+                    RKDeleteInvalidNewManagedObject(mappingOperation.destinationObject);
+                }];
+            }] : nil;
+
+            if ([connections count]) {
+                RKRelationshipConnectionOperation *relationshipConnectionOperation = [[RKRelationshipConnectionOperation alloc] initWithManagedObject:mappingOperation.destinationObject connections:connections managedObjectCache:self.managedObjectCache];
+                [relationshipConnectionOperation setConnectionBlock:^(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue) {
+                    if (connectedValue) {
+                        if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didConnectRelationship:toValue:usingConnection:)]) {
+                            [mappingOperation.delegate mappingOperation:mappingOperation didConnectRelationship:connection.relationship toValue:connectedValue usingConnection:connection];
+                        }
+                    } else {
+                        if ([mappingOperation.delegate respondsToSelector:@selector(mappingOperation:didFailToConnectRelationship:usingConnection:)]) {
+                            [mappingOperation.delegate mappingOperation:mappingOperation didFailToConnectRelationship:connection.relationship usingConnection:connection];
+                        }
                     }
-                }
-            }];
-            
-            if (self.parentOperation) [connectionOperation addDependency:self.parentOperation];
-            [deletionOperation addDependency:connectionOperation];
-            [operationQueue addOperation:connectionOperation];
-            RKLogTrace(@"Enqueued %@ dependent upon parent operation %@ to operation queue %@", connectionOperation, self.parentOperation, operationQueue);
+                }];
+
+                [deletionOperation addDependency:relationshipConnectionOperation];
+                [operationQueue addOperation:relationshipConnectionOperation];
+                RKLogTrace(@"Enqueued %@ to operation queue %@", relationshipConnectionOperation, operationQueue);
+                connectionOperation = relationshipConnectionOperation;
+            }
+
+            // Enqueue our deletion operation for execution after all the connections
+            if (deletionOperation) [operationQueue addOperation:deletionOperation];
         }
-        
-        // Enqueue our deletion operation for execution after all the connections
-        [operationQueue addOperation:deletionOperation];
 
         // Handle tombstone deletion by predicate
         if ([(RKEntityMapping *)mappingOperation.objectMapping deletionPredicate]) {
@@ -30,21 +30,18 @@
 #define RKLogComponent RKlcl_cRestKitCoreData
 
 @interface RKPropertyInspector ()
-@property (nonatomic, assign) dispatch_queue_t queue;
-@property (nonatomic, strong) NSMutableDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *inspectionCache;
+- (void)cachePropertyInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key;
 @end
 
 @implementation RKPropertyInspector (CoreData)
 
 - (NSDictionary *)propertyInspectionForEntity:(NSEntityDescription *)entity
 {
-    __block NSMutableDictionary *entityInspection;
-    dispatch_sync(self.queue, ^{
-        entityInspection = [self.inspectionCache objectForKey:[entity name]];
-    });
-    if (entityInspection) return entityInspection;
+    NSDictionary *cachedInspection = [self.inspectionCache objectForKey:[entity name]];
+    if (cachedInspection) return cachedInspection;
 
-    entityInspection = [NSMutableDictionary dictionary];
+    NSMutableDictionary *entityInspection = [NSMutableDictionary dictionary];
     for (NSString *name in [entity attributesByName]) {
         NSAttributeDescription *attributeDescription = [[entity attributesByName] valueForKey:name];
         if ([attributeDescription attributeValueClassName]) {
@@ -52,9 +49,7 @@
             if ([cls isSubclassOfClass:[NSNumber class]] && [attributeDescription attributeType] == NSBooleanAttributeType) {
                 cls = objc_getClass("NSCFBoolean") ?: objc_getClass("__NSCFBoolean") ?: cls;
             }
-            NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: name,
-                                                  RKPropertyInspectionKeyValueCodingClassKey: cls,
-                                                  RKPropertyInspectionIsPrimitiveKey: @(NO) };
+            RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:name keyValueCodingClass:cls isPrimitive:NO];
             [entityInspection setValue:propertyInspection forKey:name];
 
         } else if ([attributeDescription attributeType] == NSTransformableAttributeType &&
@@ -71,9 +66,7 @@
                 const char *attr = property_getAttributes(prop);
                 Class destinationClass = RKKeyValueCodingClassFromPropertyAttributes(attr);
                 if (destinationClass) {
-                    NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: name,
-                                                          RKPropertyInspectionKeyValueCodingClassKey: destinationClass,
-                                                          RKPropertyInspectionIsPrimitiveKey: @(NO) };
+                    RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:name keyValueCodingClass:destinationClass isPrimitive:NO];
                     [entityInspection setObject:propertyInspection forKey:name];
                 }
             }
@@ -84,14 +77,10 @@
         NSRelationshipDescription *relationshipDescription = [[entity relationshipsByName] valueForKey:name];
         if ([relationshipDescription isToMany]) {
             if ([relationshipDescription isOrdered]) {
-                NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: name,
-                                                      RKPropertyInspectionKeyValueCodingClassKey: [NSOrderedSet class],
-                                                      RKPropertyInspectionIsPrimitiveKey: @(NO) };
+                RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:name keyValueCodingClass:[NSOrderedSet class] isPrimitive:NO];
                 [entityInspection setObject:propertyInspection forKey:name];
             } else {
-                NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: name,
-                                                      RKPropertyInspectionKeyValueCodingClassKey: [NSSet class],
-                                                      RKPropertyInspectionIsPrimitiveKey: @(NO) };
+                RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:name keyValueCodingClass:[NSSet class] isPrimitive:NO];
                 [entityInspection setObject:propertyInspection forKey:name];
             }
         } else {
@@ -100,25 +89,22 @@
             if (! destinationClass) {
                 RKLogWarning(@"Retrieved `Nil` value for class named '%@': This likely indicates that the class is invalid or does not exist in the current target.", [destinationEntity managedObjectClassName]);
             }
-            NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: name,
-                                                  RKPropertyInspectionKeyValueCodingClassKey: destinationClass ?: [NSNull null],
-                                                  RKPropertyInspectionIsPrimitiveKey: @(NO) };
+            RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:name keyValueCodingClass:destinationClass isPrimitive:NO];
             [entityInspection setObject:propertyInspection forKey:name];
         }
     }
 
-    dispatch_barrier_async(self.queue, ^{
-        [self.inspectionCache setObject:entityInspection forKey:[entity name]];
-        RKLogDebug(@"Cached property inspection for Entity '%@': %@", entity, entityInspection);
-    });
-    return entityInspection;
+    cachedInspection = [entityInspection copy];
+    [self cachePropertyInspection:cachedInspection forKey:[entity name]];
+    RKLogDebug(@"Cached property inspection for Entity '%@': %@", entity, cachedInspection);
+    return cachedInspection;
 }
 
 - (Class)classForPropertyNamed:(NSString *)propertyName ofEntity:(NSEntityDescription *)entity
 {
     NSDictionary *entityInspection = [self propertyInspectionForEntity:entity];
-    NSDictionary *propertyInspection = [entityInspection objectForKey:propertyName];
-    return [propertyInspection objectForKey:RKPropertyInspectionKeyValueCodingClassKey];
+    RKPropertyInspection *propertyInspection = [entityInspection objectForKey:propertyName];
+    return propertyInspection.keyValueCodingClass;
 }
 
 @end
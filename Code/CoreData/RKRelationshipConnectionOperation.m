@@ -44,7 +44,8 @@ static BOOL RKConnectionAttributeValuesIsNotConnectable(NSDictionary *attributeV
     return [[NSSet setWithArray:[attributeValues allValues]] isEqualToSet:[NSSet setWithObject:[NSNull null]]];
 }
 
-static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescription *connection, NSManagedObject *managedObject)
+NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescription *connection, NSManagedObject *managedObject);
+NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescription *connection, NSManagedObject *managedObject)
 {
     NSCAssert([connection isForeignKeyConnection], @"Only valid for a foreign key connection");
     NSMutableDictionary *destinationEntityAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[connection.attributes count]];
@@ -56,45 +57,8 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
     return RKConnectionAttributeValuesIsNotConnectable(destinationEntityAttributeValues) ? nil : destinationEntityAttributeValues;
 }
 
-@interface RKRelationshipConnectionOperation ()
-@property (nonatomic, strong, readwrite) NSManagedObject *managedObject;
-@property (nonatomic, strong, readwrite) NSArray *connections;
-@property (nonatomic, strong, readwrite) id<RKManagedObjectCaching> managedObjectCache;
-@property (nonatomic, strong, readwrite) NSError *error;
-@property (nonatomic, strong, readwrite) NSMutableDictionary *connectedValuesByRelationshipName;
-@property (nonatomic, copy) void (^connectionBlock)(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue);
-
-// Helpers
-@property (weak, nonatomic, readonly) NSManagedObjectContext *managedObjectContext;
-
-@end
-
-@implementation RKRelationshipConnectionOperation
-
-- (id)initWithManagedObject:(NSManagedObject *)managedObject
-                connections:(NSArray *)connections
-         managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache
-{
-    NSParameterAssert(managedObject);
-    NSAssert([managedObject isKindOfClass:[NSManagedObject class]], @"Relationship connection requires an instance of NSManagedObject");
-    NSParameterAssert(connections);
-    NSParameterAssert(managedObjectCache);
-    self = [self init];
-    if (self) {
-        self.managedObject = managedObject;
-        self.connections = connections;
-        self.managedObjectCache = managedObjectCache;
-    }
-
-    return self;
-}
-
-- (NSManagedObjectContext *)managedObjectContext
-{
-    return self.managedObject.managedObjectContext;
-}
-
-- (id)relationshipValueForConnection:(RKConnectionDescription *)connection withConnectionResult:(id)result
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result);
+id RKRelationshipValueForConnectionResult(RKConnectionDescription *connection, id result)
 {
     // TODO: Replace with use of object mapping engine for type conversion
 
@@ -142,6 +106,146 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
     return result;
 }
 
+// Returns the singular attribute values of each combination of the elements of the collections among the given attribute values. Null elements of a collection never match an object and are skipped.
+static NSArray *RKSingularAttributeValuesWithConnectionAttributeValues(NSDictionary *attributeValues)
+{
+    NSMutableArray *combinations = [NSMutableArray arrayWithObject:[NSDictionary dictionary]];
+    for (NSString *attributeName in attributeValues) {
+        id attributeValue = [attributeValues objectForKey:attributeName];
+        id values = RKObjectIsCollection(attributeValue) ? attributeValue : @[ attributeValue ];
+        NSMutableArray *expandedCombinations = [NSMutableArray arrayWithCapacity:[combinations count] * [values count]];
+        for (NSDictionary *combination in combinations) {
+            for (id value in values) {
+                if (value == [NSNull null] && values == attributeValue) continue;
+                NSMutableDictionary *expandedCombination = [combination mutableCopy];
+                [expandedCombination setObject:value forKey:attributeName];
+                [expandedCombinations addObject:expandedCombination];
+            }
+        }
+        combinations = expandedCombinations;
+    }
+    return combinations;
+}
+
+/*
+ Looks up the objects matching each attribute value dictionary of a collection with a single request to the cache where it supports collection lookups. Attribute values containing collections, such as the array of identifiers of a to-many foreign key connection, are decomposed into singular attribute values that are deduplicated across the whole collection, and are matched by the union of the objects matching each of them.
+ */
+NSDictionary *RKManagedObjectsByConnectionAttributeValues(id<RKManagedObjectCaching> managedObjectCache, NSEntityDescription *entity, NSArray *attributeValuesCollection, NSManagedObjectContext *managedObjectContext);
+NSDictionary *RKManagedObjectsByConnectionAttributeValues(id<RKManagedObjectCaching> managedObjectCache, NSEntityDescription *entity, NSArray *attributeValuesCollection, NSManagedObjectContext *managedObjectContext)
+{
+    NSMutableOrderedSet *singularAttributeValuesCollection = [NSMutableOrderedSet orderedSetWithCapacity:[attributeValuesCollection count]];
+    NSMutableDictionary *singularAttributeValuesByAttributeValues = [NSMutableDictionary dictionary];
+    for (NSDictionary *attributeValues in attributeValuesCollection) {
+        BOOL containsCollection = NO;
+        for (id value in [attributeValues allValues]) {
+            if (RKObjectIsCollection(value)) {
+                containsCollection = YES;
+                break;
+            }
+        }
+        if (containsCollection) {
+            if ([singularAttributeValuesByAttributeValues objectForKey:attributeValues]) continue;
+            NSArray *singularAttributeValues = RKSingularAttributeValuesWithConnectionAttributeValues(attributeValues);
+            [singularAttributeValuesByAttributeValues setObject:singularAttributeValues forKey:attributeValues];
+            [singularAttributeValuesCollection addObjectsFromArray:singularAttributeValues];
+        } else {
+            [singularAttributeValuesCollection addObject:attributeValues];
+        }
+    }
+
+    NSDictionary *managedObjectsBySingularAttributeValues = nil;
+    if ([managedObjectCache respondsToSelector:@selector(managedObjectsWithEntity:attributeValuesCollection:inManagedObjectContext:)]) {
+        managedObjectsBySingularAttributeValues = [managedObjectCache managedObjectsWithEntity:entity attributeValuesCollection:[singularAttributeValuesCollection array] inManagedObjectContext:managedObjectContext];
+    } else {
+        NSMutableDictionary *managedObjectsByAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[singularAttributeValuesCollection count]];
+        for (NSDictionary *attributeValues in singularAttributeValuesCollection) {
+            NSSet *managedObjects = [managedObjectCache managedObjectsWithEntity:entity attributeValues:attributeValues inManagedObjectContext:managedObjectContext];
+            [managedObjectsByAttributeValues setObject:managedObjects ?: [NSSet set] forKey:attributeValues];
+        }
+        managedObjectsBySingularAttributeValues = managedObjectsByAttributeValues;
+    }
+    if ([singularAttributeValuesByAttributeValues count] == 0) return managedObjectsBySingularAttributeValues;
+
+    NSMutableDictionary *managedObjectsByAttributeValues = [managedObjectsBySingularAttributeValues mutableCopy];
+    [singularAttributeValuesByAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSDictionary *attributeValues, NSArray *singularAttributeValues, BOOL *stop) {
+        NSMutableSet *managedObjects = [NSMutableSet setWithCapacity:[singularAttributeValues count]];
+        for (NSDictionary *singularAttributeValue in singularAttributeValues) {
+            NSSet *matchingObjects = [managedObjectsBySingularAttributeValues objectForKey:singularAttributeValue];
+            if (matchingObjects) [managedObjects unionSet:matchingObjects];
+        }
+        [managedObjectsByAttributeValues setObject:managedObjects forKey:attributeValues];
+    }];
+    return managedObjectsByAttributeValues;
+}
+
+// Filters the objects matching the attribute values of a foreign key connection by the destination criteria of the connection and reduces them to a single object for a to-one relationship. Entity membership is checked by identity rather than by evaluating a predicate.
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects);
+id RKConnectionResultWithManagedObjects(RKConnectionDescription *connection, NSSet *managedObjects)
+{
+    NSEntityDescription *destinationEntity = [connection.relationship destinationEntity];
+    NSPredicate *destinationPredicate = connection.destinationPredicate;
+    BOOL includesSubentities = connection.includesSubentities;
+    if (destinationPredicate || ! includesSubentities) {
+        NSMutableSet *filteredObjects = [NSMutableSet setWithCapacity:[managedObjects count]];
+        for (NSManagedObject *managedObject in managedObjects) {
+            if (! includesSubentities) {
+                NSEntityDescription *entity = [managedObject entity];
+                if (entity != destinationEntity && ! [[entity name] isEqualToString:[destinationEntity name]]) continue;
+            }
+            if (destinationPredicate && ! [destinationPredicate evaluateWithObject:managedObject]) continue;
+            [filteredObjects addObject:managedObject];
+        }
+        managedObjects = filteredObjects;
+    }
+    if ([connection.relationship isToMany]) return managedObjects;
+
+    if ([managedObjects count] > 1) RKLogWarning(@"Retrieved %ld objects satisfying connection criteria for one-to-one relationship connection: only one object will be connected.", (long) [managedObjects count]);
+    return [managedObjects anyObject];
+}
+
+@interface RKRelationshipConnectionOperation ()
+@property (nonatomic, strong, readwrite) NSManagedObject *managedObject;
+@property (nonatomic, strong, readwrite) NSArray *connections;
+@property (nonatomic, strong, readwrite) id<RKManagedObjectCaching> managedObjectCache;
+@property (nonatomic, strong, readwrite) NSError *error;
+@property (nonatomic, strong, readwrite) NSMutableDictionary *connectedValuesByRelationshipName;
+@property (nonatomic, copy) void (^connectionBlock)(RKRelationshipConnectionOperation *operation, RKConnectionDescription *connection, id connectedValue);
+
+// Helpers
+@property (weak, nonatomic, readonly) NSManagedObjectContext *managedObjectContext;
+
+@end
+
+@implementation RKRelationshipConnectionOperation
+
+- (id)initWithManagedObject:(NSManagedObject *)managedObject
+                connections:(NSArray *)connections
+         managedObjectCache:(id<RKManagedObjectCaching>)managedObjectCache
+{
+    NSParameterAssert(managedObject);
+    NSAssert([managedObject isKindOfClass:[NSManagedObject class]], @"Relationship connection requires an instance of NSManagedObject");
+    NSParameterAssert(connections);
+    NSParameterAssert(managedObjectCache);
+    self = [self init];
+    if (self) {
+        self.managedObject = managedObject;
+        self.connections = connections;
+        self.managedObjectCache = managedObjectCache;
+    }
+
+    return self;
+}
+
+- (NSManagedObjectContext *)managedObjectContext
+{
+    return self.managedObject.managedObjectContext;
+}
+
+- (id)relationshipValueForConnection:(RKConnectionDescription *)connection withConnectionResult:(id)result
+{
+    return RKRelationshipValueForConnectionResult(connection, result);
+}
+
 - (id)findConnectedValueForConnection:(RKConnectionDescription *)connection shouldConnect:(BOOL *)shouldConnectRelationship
 {
     *shouldConnectRelationship = YES;
@@ -155,17 +259,15 @@ static NSDictionary *RKConnectionAttributeValuesWithObject(RKConnectionDescripti
             *shouldConnectRelationship = NO;
             return nil;
         }
-        NSSet *managedObjects = [self.managedObjectCache managedObjectsWithEntity:[connection.relationship destinationEntity]
-                                                                  attributeValues:attributeValues
-                                                           inManagedObjectContext:self.managedObjectContext];
-        if (connection.destinationPredicate) managedObjects = [managedObjects filteredSetUsingPredicate:connection.destinationPredicate];
-        if (!connection.includesSubentities) managedObjects = [managedObjects filteredSetUsingPredicate:[NSPredicate predicateWithFormat:@"entity == %@", [connection.relationship destinationEntity]]];
-        if ([connection.relationship isToMany]) {
-            connectionResult = managedObjects;
+        NSSet *managedObjects = nil;
+        if ([connection.relationship isToMany] && [[attributeValues allValues] indexOfObjectPassingTest:^BOOL(id value, NSUInteger idx, BOOL *stop) { return RKObjectIsCollection(value); }] != NSNotFound) {
+            managedObjects = [RKManagedObjectsByConnectionAttributeValues(self.managedObjectCache, [connection.relationship destinationEntity], @[ attributeValues ], self.managedObjectContext) objectForKey:attributeValues];
         } else {
-            if ([managedObjects count] > 1) RKLogWarning(@"Retrieved %ld objects satisfying connection criteria for one-to-one relationship connection: only one object will be connected.", (long) [managedObjects count]);
-            if ([managedObjects count]) connectionResult = [managedObjects anyObject];
+            managedObjects = [self.managedObjectCache managedObjectsWithEntity:[connection.relationship destinationEntity]
+                                                               attributeValues:attributeValues
+                                                        inManagedObjectContext:self.managedObjectContext];
         }
+        connectionResult = RKConnectionResultWithManagedObjects(connection, managedObjects);
     } else if ([connection isKeyPathConnection]) {
         connectionResult = [self.managedObject valueForKeyPath:connection.keyPath];
     } else {
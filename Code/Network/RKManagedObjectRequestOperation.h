@@ -84,6 +84,8 @@
 
  Once configured and registered with the object manager, any `RKManagedObjectRequestOperation` created through the manager will automatically consult the fetch request blocks and perform orphaned object cleanup. No cleanup is performed if no block in the `fetchRequestBlocks` property is found to match the URL of the request.
 
+ Orphaned objects are identified by comparing the managed object IDs matched by the fetch request to those of the managed objects in the mapping result, so the local objects are not loaded into memory unless they are to be deleted.
+
  ## Managed Object Context Save Behaviors
 
  The results of the operation can either be 'pushed' to the parent context or saved to the persistent store. Configuration is available via the `savesToPersistentStore` property. If an error is encountered while saving the managed object context, then the operation is considered to have failed and the `error` property will be set to the `NSError` object returned by the failed save.
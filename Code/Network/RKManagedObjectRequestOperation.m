@@ -412,6 +412,9 @@ static NSSet *RKManagedObjectsFromMappingResultWithMappingInfo(RKMappingResult *
     return managedObjectsInMappingResult;
 }
 
+// The number of orphaned objects materialized and deleted at a time
+static NSUInteger const RKOrphanedObjectDeletionBatchSize = 500;
+
 // Defined in RKObjectManager.h
 BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *responseDescriptors);
 
@@ -666,37 +669,76 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     return _blockSuccess;
 }
 
-- (NSSet *)localObjectsFromFetchRequests:(NSArray *)fetchRequests matchingRequestURL:(NSError **)error
+/*
+ Fetches the IDs of the local objects matched by the given fetch requests. Fetching object IDs rather than objects avoids materializing every row matched by the fetch requests, most of which will not be orphaned.
+ */
+- (NSSet *)localObjectIDsFromFetchRequests:(NSArray *)fetchRequests error:(NSError **)error
 {
-    NSMutableSet *localObjects = [NSMutableSet set];    
+    NSMutableSet *localObjectIDs = [NSMutableSet set];
     __block NSError *_blockError;
-    __block NSArray *_blockObjects;
-    
-    // Pass the fetch request blocks a relative `NSURL` object if possible
-    NSURL *URL = RKRelativeURLFromURLAndResponseDescriptors(self.HTTPRequestOperation.response.URL, self.responseDescriptors);
-    for (RKFetchRequestBlock fetchRequestBlock in [self.fetchRequestBlocks reverseObjectEnumerator]) {
-        NSFetchRequest *fetchRequest = fetchRequestBlock(URL);
-        if (fetchRequest) {
-            // Workaround for iOS 5 -- The log statement crashes if the entity is not assigned before logging
-            [fetchRequest setEntity:[[[[self.privateContext persistentStoreCoordinator] managedObjectModel] entitiesByName] objectForKey:[fetchRequest entityName]]];
-            RKLogDebug(@"Found fetch request matching URL '%@': %@", URL, fetchRequest);
+    __block NSArray *_blockObjectIDs;
 
-            [self.privateContext performBlockAndWait:^{
-                _blockObjects = [self.privateContext executeFetchRequest:fetchRequest error:&_blockError];
-            }];
+    for (NSFetchRequest *fetchRequest in fetchRequests) {
+        NSFetchRequest *objectIDFetchRequest = [fetchRequest copy];
+        [objectIDFetchRequest setResultType:NSManagedObjectIDResultType];
+        [objectIDFetchRequest setIncludesPropertyValues:NO];
+        [self.privateContext performBlockAndWait:^{
+            _blockObjectIDs = [self.privateContext executeFetchRequest:objectIDFetchRequest error:&_blockError];
+        }];
 
-            if (_blockObjects == nil) {
-                if (error) *error = _blockError;
-                return nil;
-            }
-            RKLogTrace(@"Fetched local objects matching URL '%@' with fetch request '%@': %@", URL, fetchRequest, _blockObjects);
-            [localObjects addObjectsFromArray:_blockObjects];
-        } else {
-            RKLogTrace(@"Fetch request block %@ returned nil fetch request for URL: '%@'", fetchRequestBlock, URL);
+        if (_blockObjectIDs == nil) {
+            if (error) *error = _blockError;
+            return nil;
         }
+        RKLogTrace(@"Fetched %lu local object IDs with fetch request '%@'", (unsigned long) [_blockObjectIDs count], fetchRequest);
+        [localObjectIDs addObjectsFromArray:_blockObjectIDs];
     }
 
-    return localObjects;
+    return localObjectIDs;
+}
+
+/*
+ Deletes the objects with the given IDs from the private context in batches. The permanent IDs of each batch are materialized with a single fetch request per entity, rather than faulting each object in individually as the delete rules of its relationships are applied, and temporary IDs, which cannot be fetched, are resolved with `existingObjectWithID:error:`.
+ */
+- (void)deleteObjectsWithIDs:(NSArray *)objectIDs
+{
+    [self.privateContext performBlockAndWait:^{
+        for (NSUInteger location = 0; location < [objectIDs count]; location += RKOrphanedObjectDeletionBatchSize) {
+            @autoreleasepool {
+                NSRange range = NSMakeRange(location, MIN(RKOrphanedObjectDeletionBatchSize, [objectIDs count] - location));
+                NSMutableDictionary *permanentObjectIDsByEntityName = [NSMutableDictionary dictionary];
+                for (NSManagedObjectID *objectID in [objectIDs subarrayWithRange:range]) {
+                    if ([objectID isTemporaryID]) {
+                        NSManagedObject *object = [self.privateContext existingObjectWithID:objectID error:nil];
+                        if (object) [self.privateContext deleteObject:object];
+                        continue;
+                    }
+
+                    NSMutableArray *permanentObjectIDs = [permanentObjectIDsByEntityName objectForKey:[[objectID entity] name]];
+                    if (! permanentObjectIDs) {
+                        permanentObjectIDs = [NSMutableArray array];
+                        [permanentObjectIDsByEntityName setObject:permanentObjectIDs forKey:[[objectID entity] name]];
+                    }
+                    [permanentObjectIDs addObject:objectID];
+                }
+
+                [permanentObjectIDsByEntityName enumerateKeysAndObjectsUsingBlock:^(NSString *entityName, NSArray *permanentObjectIDs, BOOL *stop) {
+                    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+                    fetchRequest.predicate = [NSPredicate predicateWithFormat:@"self IN %@", permanentObjectIDs];
+                    fetchRequest.returnsObjectsAsFaults = NO;
+                    NSError *error = nil;
+                    NSArray *objects = [self.privateContext executeFetchRequest:fetchRequest error:&error];
+                    if (! objects) {
+                        RKLogError(@"Failed to fetch orphaned objects for deletion: %@", error);
+                        return;
+                    }
+                    for (NSManagedObject *object in objects) {
+                        [self.privateContext deleteObject:object];
+                    }
+                }];
+            }
+        }
+    }];
 }
 
 - (NSArray *)fetchRequestsMatchingResponseURL
@@ -737,25 +779,24 @@ BOOL RKDoesArrayOfResponseDescriptorsContainOnlyEntityMappings(NSArray *response
     NSArray *fetchRequests = [self fetchRequestsMatchingResponseURL];
     if (! [fetchRequests count]) return YES;
     
-    // Proceed with cleanup
-    NSSet *managedObjectsInMappingResult = RKManagedObjectsFromMappingResultWithMappingInfo(mappingResult, self.mappingInfo) ?: [NSSet set];
-    NSSet *localObjects = [self localObjectsFromFetchRequests:fetchRequests matchingRequestURL:error];
-    if (! localObjects) {
+    // Proceed with cleanup, comparing object IDs so that only the orphaned objects are ever materialized
+    NSSet *localObjectIDs = [self localObjectIDsFromFetchRequests:fetchRequests error:error];
+    if (! localObjectIDs) {
         RKLogError(@"Failed when attempting to fetch local candidate objects for orphan cleanup: %@", error ? *error : nil);
         return NO;
     }
-    RKLogDebug(@"Checking mappings result of %ld objects for %ld potentially orphaned local objects...", (long) [managedObjectsInMappingResult count], (long) [localObjects count]);
-    
-    NSMutableSet *orphanedObjects = [localObjects mutableCopy];
-    [orphanedObjects minusSet:managedObjectsInMappingResult];
-    RKLogDebug(@"Deleting %lu orphaned objects found in local database, but missing from mapping result", (unsigned long) [orphanedObjects count]);
-    
-    if ([orphanedObjects count]) {
-        [self.privateContext performBlockAndWait:^{
-            for (NSManagedObject *orphanedObject in orphanedObjects) {
-                [self.privateContext deleteObject:orphanedObject];
-            }
-        }];
+    if (! [localObjectIDs count]) return YES;
+
+    NSSet *managedObjectsInMappingResult = RKManagedObjectsFromMappingResultWithMappingInfo(mappingResult, self.mappingInfo) ?: [NSSet set];
+    NSSet *objectIDsInMappingResult = [managedObjectsInMappingResult valueForKey:@"objectID"];
+    RKLogDebug(@"Checking mappings result of %ld objects for %ld potentially orphaned local objects...", (long) [objectIDsInMappingResult count], (long) [localObjectIDs count]);
+
+    NSMutableSet *orphanedObjectIDs = [localObjectIDs mutableCopy];
+    [orphanedObjectIDs minusSet:objectIDsInMappingResult];
+    RKLogDebug(@"Deleting %lu orphaned objects found in local database, but missing from mapping result", (unsigned long) [orphanedObjectIDs count]);
+
+    if ([orphanedObjectIDs count]) {
+        [self deleteObjectsWithIDs:[orphanedObjectIDs allObjects]];
     }
 
     return YES;
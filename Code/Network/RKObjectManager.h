@@ -810,6 +810,26 @@ RKMappingResult, RKRequestDescriptor, RKResponseDescriptor;
  */
 - (void)removeResponseDescriptor:(RKResponseDescriptor *)responseDescriptor;
 
+///--------------------------------
+/// @name Prewarming Mapping Caches
+///--------------------------------
+
+/**
+ Populates the caches consulted during object mapping for every mapping reachable from the request and response descriptors registered with the receiver, so that the cost is paid up front rather than by the first response processed with each mapping.
+
+ The following work is performed on a background queue:
+
+ 1. The mapping plan of each object mapping is compiled and the properties of each mapped class (or entity) are inspected with the shared `RKPropertyInspector`.
+ 1. The path pattern of each response descriptor is compiled into a path matcher.
+ 1. If the managed object cache of the `managedObjectStore` is an `RKFetchRequestManagedObjectCache`, the predicates used to identify managed objects by the identification attributes of each entity mapping are built.
+ 1. If the managed object cache of the `managedObjectStore` is an `RKInMemoryManagedObjectCache`, the instances of the entity of each entity mapping are loaded into memory by the identification attributes of the mapping.
+
+ Descriptors added after this method is called are not prewarmed.
+
+ @param completion A block to be executed on the main queue once prewarming has finished, including the loading of any in-memory managed object caches. Can be `nil`.
+ */
+- (void)prewarmWithCompletion:(void (^)(void))completion;
+
 ///----------------------------------------
 /// @name Configuring Core Data Integration
 ///----------------------------------------
@@ -36,10 +36,15 @@
 #import "RKRouter.h"
 #import "RKRoute.h"
 #import "RKRouteSet.h"
+#import "RKPropertyInspector.h"
+#import "RKObjectMappingPlan.h"
 
 #ifdef _COREDATADEFINES_H
 #import "RKManagedObjectStore.h"
 #import "RKManagedObjectRequestOperation.h"
+#import "RKFetchRequestManagedObjectCache.h"
+#import "RKInMemoryManagedObjectCache.h"
+#import "RKPropertyInspector+CoreData.h"
 #endif
 
 #if !__has_feature(objc_arc)
@@ -327,6 +332,16 @@ static NSString *RKMIMETypeFromAFHTTPClientParameterEncoding(AFHTTPClientParamet
     return RKMIMETypeFormURLEncoded;
 }
 
+@interface RKResponseDescriptor ()
+- (RKPathMatcher *)pathMatcher;
+@end
+
+#ifdef _COREDATADEFINES_H
+@interface RKFetchRequestManagedObjectCache ()
+- (id)fetchRequestTemplateForEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues;
+@end
+#endif
+
 @interface AFHTTPClient ()
 @property (readonly, nonatomic, strong) NSURLCredential *defaultCredential;
 @end
@@ -880,6 +895,96 @@ static NSString *RKMIMETypeFromAFHTTPClientParameterEncoding(AFHTTPClientParamet
 
 #endif
 
+#pragma mark - Prewarming
+
+// Warms the plan and property inspection caches consulted when mapping with the given mapping
+static void RKPrewarmMapping(RKMapping *mapping)
+{
+    if (! [mapping isKindOfClass:[RKObjectMapping class]]) return;
+    RKObjectMapping *objectMapping = (RKObjectMapping *)mapping;
+    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
+#ifdef _COREDATADEFINES_H
+    if ([objectMapping isKindOfClass:[RKEntityMapping class]]) [inspector propertyInspectionForEntity:[(RKEntityMapping *)objectMapping entity]];
+#endif
+    if (! objectMapping.objectClass) return;
+    [inspector propertyInspectionForClass:objectMapping.objectClass];
+    for (RKPlannedPropertyMapping *plannedMapping in [objectMapping mappingPlan].attributeMappings) {
+        if ([plannedMapping.destinationKeyPathComponents count] == 1) {
+            [inspector propertyAccessorForPropertyNamed:plannedMapping.propertyMapping.destinationKeyPath ofClass:objectMapping.objectClass];
+        }
+    }
+}
+
+#ifdef _COREDATADEFINES_H
+// Prepares the singular and collection identification fetch request templates used by the fetch request cache for the entity mapping
+static void RKPrewarmFetchRequestCacheForEntityMapping(RKFetchRequestManagedObjectCache *managedObjectCache, RKEntityMapping *entityMapping)
+{
+    NSArray *attributeNames = [entityMapping.identificationAttributes valueForKey:@"name"];
+    if ([attributeNames count] == 0) return;
+    NSMutableDictionary *singularAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeNames count]];
+    NSMutableDictionary *collectionAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeNames count]];
+    for (NSString *attributeName in attributeNames) {
+        [singularAttributeValues setObject:[NSNull null] forKey:attributeName];
+        [collectionAttributeValues setObject:@[] forKey:attributeName];
+    }
+    [managedObjectCache fetchRequestTemplateForEntity:entityMapping.entity attributeValues:singularAttributeValues];
+    [managedObjectCache fetchRequestTemplateForEntity:entityMapping.entity attributeValues:collectionAttributeValues];
+}
+#endif
+
+- (void)prewarmWithCompletion:(void (^)(void))completion
+{
+    NSArray *requestDescriptors = self.requestDescriptors;
+    NSArray *responseDescriptors = self.responseDescriptors;
+#ifdef _COREDATADEFINES_H
+    id<RKManagedObjectCaching> managedObjectCache = self.managedObjectStore.managedObjectCache;
+#endif
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
+        dispatch_group_t dispatchGroup = dispatch_group_create();
+
+        // Visit all mappings accessible from the object graphs of all request and response descriptors
+        NSMutableSet *accessibleMappings = [NSMutableSet set];
+        for (id descriptor in [requestDescriptors arrayByAddingObjectsFromArray:responseDescriptors]) {
+            RKMapping *mapping = [descriptor mapping];
+            if (! [accessibleMappings containsObject:mapping]) {
+                RKMappingGraphVisitor *graphVisitor = [[RKMappingGraphVisitor alloc] initWithMapping:mapping];
+                [accessibleMappings unionSet:graphVisitor.mappings];
+            }
+        }
+
+        for (RKMapping *mapping in accessibleMappings) {
+            RKPrewarmMapping(mapping);
+#ifdef _COREDATADEFINES_H
+            if ([mapping isKindOfClass:[RKEntityMapping class]] && [(id)managedObjectCache isKindOfClass:[RKFetchRequestManagedObjectCache class]]) {
+                RKPrewarmFetchRequestCacheForEntityMapping((RKFetchRequestManagedObjectCache *)managedObjectCache, (RKEntityMapping *)mapping);
+            }
+            if ([mapping isKindOfClass:[RKEntityMapping class]] && [(id)managedObjectCache isKindOfClass:[RKInMemoryManagedObjectCache class]]) {
+                RKEntityMapping *entityMapping = (RKEntityMapping *)mapping;
+                NSArray *attributeNames = [entityMapping.identificationAttributes valueForKey:@"name"];
+                if ([attributeNames count]) {
+                    dispatch_group_enter(dispatchGroup);
+                    [(RKInMemoryManagedObjectCache *)managedObjectCache loadEntity:entityMapping.entity byAttributes:attributeNames completion:^{
+                        dispatch_group_leave(dispatchGroup);
+                    }];
+                }
+            }
+#endif
+        }
+
+        for (RKResponseDescriptor *responseDescriptor in responseDescriptors) {
+            [responseDescriptor pathMatcher];
+        }
+
+        RKLogDebug(@"Prewarmed %ld mappings reachable from %ld request and %ld response descriptors", (long) [accessibleMappings count], (long) [requestDescriptors count], (long) [responseDescriptors count]);
+        // Managed object caches finish loading asynchronously
+        if (completion) dispatch_group_notify(dispatchGroup, dispatch_get_main_queue(), completion);
+#if !OS_OBJECT_USE_OBJC
+        dispatch_release(dispatchGroup);
+#endif
+    });
+}
+
 #pragma mark - Queue Management
 
 - (void)enqueueObjectRequestOperation:(RKObjectRequestOperation *)objectRequestOperation
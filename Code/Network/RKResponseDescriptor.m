@@ -65,6 +65,7 @@ extern NSString *RKStringDescribingRequestMethod(RKRequestMethod method);
 @property (nonatomic, copy, readwrite) NSString *pathPattern;
 @property (nonatomic, copy, readwrite) NSString *keyPath;
 @property (nonatomic, copy, readwrite) NSIndexSet *statusCodes;
+@property (atomic, strong) RKPathMatcher *compiledPathMatcher;
 @end
 
 @implementation RKResponseDescriptor
@@ -106,10 +107,23 @@ extern NSString *RKStringDescribingRequestMethod(RKRequestMethod method);
 - (BOOL)matchesPath:(NSString *)path
 {
     if (!self.pathPattern || !path) return YES;
-    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:self.pathPattern];
+    // Matching mutates the matcher, so each match is performed against a copy sharing the compiled pattern
+    RKPathMatcher *pathMatcher = [[self pathMatcher] copy];
     return [pathMatcher matchesPath:path tokenizeQueryStrings:NO parsedArguments:nil];
 }
 
+// Returns a path matcher for the path pattern, compiling it on first access
+- (RKPathMatcher *)pathMatcher
+{
+    if (! self.pathPattern) return nil;
+    RKPathMatcher *pathMatcher = self.compiledPathMatcher;
+    if (! pathMatcher) {
+        pathMatcher = [RKPathMatcher pathMatcherWithPattern:self.pathPattern];
+        self.compiledPathMatcher = pathMatcher;
+    }
+    return pathMatcher;
+}
+
 - (BOOL)matchesURL:(NSURL *)URL
 {
     NSString *pathAndQueryString = RKPathAndQueryStringFromURLRelativeToURL(URL, self.baseURL);
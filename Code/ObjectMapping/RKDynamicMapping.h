@@ -33,6 +33,10 @@
 
  When both a mapping selection block and matchers are configured on a `RKDynamicMapping` object, the matcher objects are consulted first and if none match, the selection block is invoked.
 
+ ## Matcher Dispatch
+
+ Key path matchers that share a key path and expect an `NSString` or `NSNumber` value are compiled into a hash index from expected value to matcher. When a representation is mapped, each such key path is read once and the matcher is resolved with a single lookup, regardless of how many types are registered. Predicate matchers and other key path matchers are evaluated in order as a fallback. The result is always the same as evaluating every matcher in registration order. The index is rebuilt when a matcher is added or removed.
+
  ## Using Matcher Objects
 
  The `RKObjectMappingMatcher` class provides an interface for evaluating a key path or predicate based match and returning an appropriate object mapping. Matchers can be added to the `RKDynamicMapping` objects to declaratively describe a particular mapping strategy.
@@ -112,4 +116,23 @@
  */
 - (RKObjectMapping *)objectMappingForRepresentation:(id)representation;
 
+///-------------------------------
+/// @name Inspecting Matcher Usage
+///-------------------------------
+
+/**
+ Returns the number of object representations for which the given matcher has been selected by `objectMappingForRepresentation:`.
+
+ Hit counts are useful for tuning the registration order of predicate matchers in heterogeneous collections. Counts are retained until `resetMatchCounts` is invoked.
+
+ @param matcher The matcher for which to return the number of matches.
+ @return The number of times the matcher was selected by the receiver.
+ */
+- (NSUInteger)numberOfMatchesForMatcher:(RKObjectMappingMatcher *)matcher;
+
+/**
+ Resets the match counts of all matchers to zero.
+ */
+- (void)resetMatchCounts;
+
 @end
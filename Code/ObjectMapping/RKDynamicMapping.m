@@ -26,9 +26,89 @@
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitObjectMapping
 
+// Defined in RKObjectMappingMatcher.m
+@interface RKKeyPathObjectMappingMatcher : RKObjectMappingMatcher
+@property (nonatomic, copy) NSString *keyPath;
+@property (nonatomic, strong, readwrite) id expectedValue;
+@end
+
+/**
+ An immutable dispatch table built from the matchers of a dynamic mapping. Key path matchers with an `NSString` or `NSNumber` expected value are grouped by key path into a dictionary from expected value to matcher, so that the key path is read once per representation and resolved with a single hash lookup. All other matchers are evaluated in registration order as a fallback. Each matcher carries its registration index so that the first matching matcher wins exactly as if all matchers had been evaluated linearly.
+ */
+@interface RKObjectMappingMatcherIndex : NSObject
+@property (nonatomic, copy) NSArray *matchers;
+@property (nonatomic, copy) NSDictionary *matcherIndexesByExpectedValueByKeyPath;
+@property (nonatomic, copy) NSArray *fallbackMatcherIndexes;
+
+- (id)initWithMatchers:(NSArray *)matchers;
+- (RKObjectMappingMatcher *)matcherForRepresentation:(id)representation;
+@end
+
+@implementation RKObjectMappingMatcherIndex
+
+- (id)initWithMatchers:(NSArray *)matchers
+{
+    self = [super init];
+    if (self) {
+        NSMutableDictionary *matcherIndexesByExpectedValueByKeyPath = [NSMutableDictionary dictionary];
+        NSMutableArray *fallbackMatcherIndexes = [NSMutableArray array];
+
+        [matchers enumerateObjectsUsingBlock:^(RKObjectMappingMatcher *matcher, NSUInteger idx, BOOL *stop) {
+            if ([matcher isKindOfClass:[RKKeyPathObjectMappingMatcher class]]) {
+                RKKeyPathObjectMappingMatcher *keyPathMatcher = (RKKeyPathObjectMappingMatcher *)matcher;
+                id expectedValue = keyPathMatcher.expectedValue;
+                // Only values whose `hash` and `isEqual:` agree with `RKObjectIsEqualToObject` are safe to index
+                if ([expectedValue isKindOfClass:[NSString class]] || [expectedValue isKindOfClass:[NSNumber class]]) {
+                    NSMutableDictionary *matcherIndexesByExpectedValue = [matcherIndexesByExpectedValueByKeyPath objectForKey:keyPathMatcher.keyPath];
+                    if (! matcherIndexesByExpectedValue) {
+                        matcherIndexesByExpectedValue = [NSMutableDictionary dictionary];
+                        [matcherIndexesByExpectedValueByKeyPath setObject:matcherIndexesByExpectedValue forKey:keyPathMatcher.keyPath];
+                    }
+                    // The first matcher registered for a value wins, as it would in a linear search
+                    if (! [matcherIndexesByExpectedValue objectForKey:expectedValue]) [matcherIndexesByExpectedValue setObject:@(idx) forKey:expectedValue];
+                    return;
+                }
+            }
+            [fallbackMatcherIndexes addObject:@(idx)];
+        }];
+
+        self.matchers = matchers;
+        self.matcherIndexesByExpectedValueByKeyPath = matcherIndexesByExpectedValueByKeyPath;
+        self.fallbackMatcherIndexes = fallbackMatcherIndexes;
+    }
+
+    return self;
+}
+
+- (RKObjectMappingMatcher *)matcherForRepresentation:(id)representation
+{
+    NSUInteger matchingIndex = NSNotFound;
+
+    // Resolve each discriminator key path with a single read and hash lookup, keeping the earliest registered hit
+    for (NSString *keyPath in self.matcherIndexesByExpectedValueByKeyPath) {
+        id value = [representation valueForKeyPath:keyPath];
+        if (value == nil) continue;
+        NSNumber *index = [[self.matcherIndexesByExpectedValueByKeyPath objectForKey:keyPath] objectForKey:value];
+        if (index && [index unsignedIntegerValue] < matchingIndex) matchingIndex = [index unsignedIntegerValue];
+    }
+
+    // Evaluate the remaining matchers only if they were registered ahead of the indexed hit
+    for (NSNumber *index in self.fallbackMatcherIndexes) {
+        if ([index unsignedIntegerValue] >= matchingIndex) break;
+        RKObjectMappingMatcher *matcher = [self.matchers objectAtIndex:[index unsignedIntegerValue]];
+        if ([matcher matches:representation]) return matcher;
+    }
+
+    return (matchingIndex == NSNotFound) ? nil : [self.matchers objectAtIndex:matchingIndex];
+}
+
+@end
+
 @interface RKDynamicMapping ()
 @property (nonatomic, strong) NSMutableArray *mutableMatchers;
 @property (nonatomic, copy) RKObjectMapping *(^objectMappingForRepresentationBlock)(id representation);
+@property (atomic, strong) RKObjectMappingMatcherIndex *matcherIndex;
+@property (nonatomic, strong) NSCountedSet *matcherHitCounts;
 @end
 
 @implementation RKDynamicMapping
@@ -38,6 +118,7 @@
     self = [super init];
     if (self) {
         self.mutableMatchers = [NSMutableArray new];
+        self.matcherHitCounts = [NSCountedSet new];
     }
 
     return self;
@@ -62,12 +143,38 @@
     } else {
         [self.mutableMatchers addObject:matcher];
     }
+    self.matcherIndex = nil;
 }
 
 - (void)removeMatcher:(RKObjectMappingMatcher *)matcher
 {
     NSParameterAssert(matcher);
     [self.mutableMatchers removeObject:matcher];
+    self.matcherIndex = nil;
+}
+
+- (RKObjectMappingMatcherIndex *)indexOfMatchers
+{
+    RKObjectMappingMatcherIndex *matcherIndex = self.matcherIndex;
+    if (! matcherIndex) {
+        matcherIndex = [[RKObjectMappingMatcherIndex alloc] initWithMatchers:[self.mutableMatchers copy]];
+        self.matcherIndex = matcherIndex;
+    }
+    return matcherIndex;
+}
+
+- (NSUInteger)numberOfMatchesForMatcher:(RKObjectMappingMatcher *)matcher
+{
+    @synchronized(self.matcherHitCounts) {
+        return [self.matcherHitCounts countForObject:matcher];
+    }
+}
+
+- (void)resetMatchCounts
+{
+    @synchronized(self.matcherHitCounts) {
+        [self.matcherHitCounts removeAllObjects];
+    }
 }
 
 - (RKObjectMapping *)objectMappingForRepresentation:(id)representation
@@ -77,11 +184,13 @@
     RKLogTrace(@"Performing dynamic object mapping for object representation: %@", representation);
 
     // Consult the declarative matchers first
-    for (RKObjectMappingMatcher *matcher in self.mutableMatchers) {
-        if ([matcher matches:representation]) {
-            RKLogTrace(@"Found declarative match for matcher: %@.", matcher);
-            return matcher.objectMapping;
+    RKObjectMappingMatcher *matcher = [[self indexOfMatchers] matcherForRepresentation:representation];
+    if (matcher) {
+        RKLogTrace(@"Found declarative match for matcher: %@.", matcher);
+        @synchronized(self.matcherHitCounts) {
+            [self.matcherHitCounts addObject:matcher];
         }
+        return matcher.objectMapping;
     }
 
     // Otherwise consult the block
@@ -150,6 +150,15 @@
  */
 @property (nonatomic, copy) NSDictionary *metadata;
 
+/**
+ A Boolean value that determines if collections of object representations are mapped concurrently across all available cores.
+
+ Concurrent collection mapping is only performed when the `mappingOperationDataSource` is an instance of `RKObjectMappingOperationDataSource`, which shares no mutable state between mapping operations. Any other data source (such as `RKManagedObjectMappingOperationDataSource`) is always mapped serially. The mapped objects and the `mappingInfo` are reported in collection order and all delegate messages are sent from the thread executing the mapper, but every `mapper:willStartMappingOperation:forKeyPath:` message for a collection is sent before the first `mapper:didFinishMappingOperation:forKeyPath:` message. Any mapping operation delegate, value transformer or dynamic mapping block configured on the mappings must be safe to invoke from multiple threads. The date formatters of the default value transformer are shared by all mappings and are not thread-safe on iOS 5 and 6, so transformations to and from `NSDate` values are serialized across the concurrently executing mapping operations; all other transformations run concurrently. Serially mapped collections never take this lock.
+
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL mapsCollectionsConcurrently;
+
 ///------------------------------
 /// @name Executing the Operation
 ///------------------------------
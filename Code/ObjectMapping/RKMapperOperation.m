@@ -56,6 +56,10 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 - (id)initWithObject:(id)object parentObject:(id)parentObject rootObject:(id)rootObject metadata:(NSDictionary *)metadata;
 @end
 
+@interface RKMappingOperation (Private)
+@property (nonatomic, assign) BOOL synchronizesDateTransformations;
+@end
+
 @interface RKMapperOperation ()
 
 @property (nonatomic, strong, readwrite) NSError *error;
@@ -207,8 +211,32 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
         }
     }
     
+    // Give the data source a chance to identify the target objects of the whole collection at once
+    BOOL preparedTargetObjects = NO;
+    if ([objectsToMap isKindOfClass:[NSArray class]] && [objectsToMap count] > 1 && [self.mappingOperationDataSource respondsToSelector:@selector(prepareTargetObjectsForRepresentations:withMapping:)]) {
+        [self.mappingOperationDataSource prepareTargetObjectsForRepresentations:objectsToMap withMapping:mapping];
+        preparedTargetObjects = YES;
+    }
+
+    NSArray *mappedObjects = nil;
+    if ([self shouldMapRepresentationsConcurrently:objectsToMap]) {
+        mappedObjects = [self concurrentlyMapRepresentations:objectsToMap atKeyPath:keyPath usingMapping:mapping];
+    } else {
+        mappedObjects = [self seriallyMapRepresentations:objectsToMap atKeyPath:keyPath usingMapping:mapping];
+    }
+
+    // Let the data source release the target objects it prepared for this collection
+    if (preparedTargetObjects && [self.mappingOperationDataSource respondsToSelector:@selector(didMapRepresentations:withMapping:)]) {
+        [self.mappingOperationDataSource didMapRepresentations:objectsToMap withMapping:mapping];
+    }
+
+    return mappedObjects;
+}
+
+- (NSArray *)seriallyMapRepresentations:(id)representations atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping
+{
     NSMutableArray *mappedObjects = [NSMutableArray arrayWithCapacity:[representations count]];
-    [objectsToMap enumerateObjectsUsingBlock:^(id mappableObject, NSUInteger index, BOOL *stop) {
+    [representations enumerateObjectsUsingBlock:^(id mappableObject, NSUInteger index, BOOL *stop) {
         id destinationObject = [self objectForRepresentation:mappableObject withMapping:mapping];
         if (destinationObject) {
             BOOL success = [self mapRepresentation:mappableObject toObject:destinationObject atKeyPath:keyPath usingMapping:mapping metadata:@{ @"mapping": @{ @"collectionIndex": @(index) } }];
@@ -220,8 +248,57 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     return mappedObjects;
 }
 
-// The workhorse of this entire process. Emits object loading operations
-- (BOOL)mapRepresentation:(id)mappableObject toObject:(id)destinationObject atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadata:(NSDictionary *)metadata
+// Concurrent mapping is only safe when the data source shares no mutable state between mapping operations
+- (BOOL)shouldMapRepresentationsConcurrently:(id)representations
+{
+    return self.mapsCollectionsConcurrently
+        && [self.mappingOperationDataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]]
+        && [representations isKindOfClass:[NSArray class]]
+        && [representations count] > 1;
+}
+
+// Instantiates the destination objects and mapping operations serially, runs the operations in chunks across all cores, then reports the results in collection order
+- (NSArray *)concurrentlyMapRepresentations:(NSArray *)representations atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping
+{
+    NSUInteger count = [representations count];
+    NSMutableArray *mappingOperations = [NSMutableArray arrayWithCapacity:count];
+    [representations enumerateObjectsUsingBlock:^(id mappableObject, NSUInteger index, BOOL *stop) {
+        id destinationObject = [self objectForRepresentation:mappableObject withMapping:mapping];
+        if (destinationObject) {
+            RKMappingOperation *mappingOperation = [self mappingOperationForRepresentation:mappableObject toObject:destinationObject atKeyPath:keyPath usingMapping:mapping metadata:@{ @"mapping": @{ @"collectionIndex": @(index) } }];
+            mappingOperation.synchronizesDateTransformations = YES;
+            [mappingOperations addObject:mappingOperation];
+        }
+        *stop = [self isCancelled];
+    }];
+    if ([self isCancelled]) return nil;
+
+    NSUInteger operationCount = [mappingOperations count];
+    NSUInteger chunkCount = MIN(operationCount, [[NSProcessInfo processInfo] activeProcessorCount] * 4);
+    if (chunkCount == 0) return @[];
+    NSUInteger chunkSize = (operationCount + chunkCount - 1) / chunkCount;
+    RKLogDebug(@"Concurrently mapping %ld representations at keyPath '%@' in %ld chunks", (long) operationCount, keyPath, (long) chunkCount);
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunkIndex) {
+        @autoreleasepool {
+            NSUInteger location = chunkIndex * chunkSize;
+            NSUInteger length = MIN(chunkSize, operationCount - MIN(location, operationCount));
+            for (RKMappingOperation *mappingOperation in [mappingOperations subarrayWithRange:NSMakeRange(location, length)]) {
+                if ([self isCancelled]) break;
+                [mappingOperation start];
+            }
+        }
+    });
+    if ([self isCancelled]) return nil;
+
+    NSMutableArray *mappedObjects = [NSMutableArray arrayWithCapacity:operationCount];
+    for (RKMappingOperation *mappingOperation in mappingOperations) {
+        if ([self finishMappingOperation:mappingOperation atKeyPath:keyPath]) [mappedObjects addObject:mappingOperation.destinationObject];
+    }
+
+    return mappedObjects;
+}
+
+- (RKMappingOperation *)mappingOperationForRepresentation:(id)mappableObject toObject:(id)destinationObject atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadata:(NSDictionary *)metadata
 {
     NSAssert(destinationObject != nil, @"Cannot map without a target object to assign the results to");
     NSAssert(mappableObject != nil, @"Cannot map without a collection of attributes");
@@ -239,7 +316,21 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     if ([self.delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)]) {
         [self.delegate mapper:self willStartMappingOperation:mappingOperation forKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
     }
+
+    return mappingOperation;
+}
+
+// The workhorse of this entire process. Emits object loading operations
+- (BOOL)mapRepresentation:(id)mappableObject toObject:(id)destinationObject atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadata:(NSDictionary *)metadata
+{
+    RKMappingOperation *mappingOperation = [self mappingOperationForRepresentation:mappableObject toObject:destinationObject atKeyPath:keyPath usingMapping:mapping metadata:metadata];
     [mappingOperation start];
+    return [self finishMappingOperation:mappingOperation atKeyPath:keyPath];
+}
+
+// Notifies the delegate of the outcome of a mapping operation and records its errors or mapping info
+- (BOOL)finishMappingOperation:(RKMappingOperation *)mappingOperation atKeyPath:(NSString *)keyPath
+{
     if (mappingOperation.error) {
         if ([self.delegate respondsToSelector:@selector(mapper:didFailMappingOperation:forKeyPath:withError:)]) {
             [self.delegate mapper:self didFailMappingOperation:mappingOperation forKeyPath:RKDelegateKeyPathFromKeyPath(keyPath) withError:mappingOperation.error];
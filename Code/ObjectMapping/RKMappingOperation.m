@@ -32,6 +32,7 @@
 #import "RKObjectUtilities.h"
 #import "RKValueTransformers.h"
 #import "RKDictionaryUtilities.h"
+#import "RKObjectMappingPlan.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -42,10 +43,9 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
 /**
  This function ensures that attribute mappings apply cleanly to an `NSMutableDictionary` target class to support mapping to nested keyPaths. See issue #882
  */
-static void RKSetIntermediateDictionaryValuesOnObjectForKeyPath(id object, NSString *keyPath)
+static void RKSetIntermediateDictionaryValuesOnObjectForKeyPathComponents(id object, NSArray *keyPathComponents)
 {
     if (! [object isKindOfClass:[NSMutableDictionary class]]) return;
-    NSArray *keyPathComponents = [keyPath componentsSeparatedByString:@"."];
     if ([keyPathComponents count] > 1) {
         for (NSUInteger index = 0; index < [keyPathComponents count] - 1; index++) {
             NSString *intermediateKeyPath = [[keyPathComponents subarrayWithRange:NSMakeRange(0, index + 1)] componentsJoinedByString:@"."];
@@ -105,6 +105,19 @@ static BOOL RKObjectContainsValueForKeyPaths(id representation, NSArray *keyPath
     return NO;
 }
 
+/*
+ Date formatters are not thread-safe on iOS 5 and 6, and the `RKISO8601DateFormatter` of the default value transformer is shared by every mapping, so transformations to and from dates are serialized across mapping operations that execute concurrently. Operations that are started serially never take the lock.
+ */
+static NSObject *RKDateTransformationLock(void)
+{
+    static NSObject *dateTransformationLock = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        dateTransformationLock = [NSObject new];
+    });
+    return dateTransformationLock;
+}
+
 static NSString *const RKMetadataKey = @"@metadata";
 static NSString *const RKMetadataKeyPathPrefix = @"@metadata.";
 static NSString *const RKParentKey = @"@parent";
@@ -252,14 +265,16 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 @interface RKMappingOperation ()
 @property (nonatomic, strong, readwrite) RKMapping *mapping;
 @property (nonatomic, strong, readwrite) id sourceObject;
+@property (nonatomic, strong) id sourceRepresentation; // The unwrapped `sourceObject`
 @property (nonatomic, strong, readwrite) id parentSourceObject;
 @property (nonatomic, strong, readwrite) id rootSourceObject;
 @property (nonatomic, strong, readwrite) id destinationObject;
 @property (nonatomic, strong) NSDictionary *nestedAttributeSubstitution;
 @property (nonatomic, strong, readwrite) NSError *error;
 @property (nonatomic, strong, readwrite) RKObjectMapping *objectMapping; // The concrete mapping
-@property (nonatomic, strong) NSArray *nestedAttributeMappings;
+@property (nonatomic, strong) RKObjectMappingPlan *mappingPlan;
 @property (nonatomic, strong) RKMappingInfo *mappingInfo;
+@property (nonatomic, assign) BOOL synchronizesDateTransformations; // Set by `RKMapperOperation` on operations that it executes concurrently
 @end
 
 @implementation RKMappingOperation
@@ -280,11 +295,11 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return self;
 }
 
-- (id)parentObjectForRelationshipMapping:(RKRelationshipMapping *)mapping
+- (id)parentObjectForRelationshipMapping:(RKPlannedPropertyMapping *)plannedMapping
 {
     id parentSourceObject = self.sourceObject;
 
-    NSArray *sourceKeyComponents = [mapping.sourceKeyPath componentsSeparatedByString:@"."];
+    NSArray *sourceKeyComponents = plannedMapping.sourceKeyPathComponents;
     if (sourceKeyComponents.count > 1)
     {
         for (NSString *key in [sourceKeyComponents subarrayWithRange:NSMakeRange(0, sourceKeyComponents.count - 1)])
@@ -318,6 +333,39 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return [self.dataSource mappingOperation:self targetObjectForRepresentation:(NSDictionary *)sourceObject withMapping:concreteMapping inRelationship:relationshipMapping];
 }
 
+- (id)sourceValueForPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping
+{
+    // Only key paths beginning with `@metadata`, `@parent` or `@root` need to go through the `RKMappingSourceObject` proxy
+    if (plannedMapping.readsSourceValueDirectly && [self.sourceRepresentation isKindOfClass:[NSDictionary class]]) {
+        return [plannedMapping sourceValueFromRepresentation:self.sourceRepresentation];
+    }
+    return [self.sourceObject valueForKeyPath:plannedMapping.propertyMapping.sourceKeyPath];
+}
+
+// Returns an accessor for directly invoking the getter and setter of the destination property, or `nil` if key-value coding must be used
+- (RKPropertyAccessor *)destinationPropertyAccessorForPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping
+{
+    if ([plannedMapping.destinationKeyPathComponents count] != 1) return nil;
+    return [[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:plannedMapping.propertyMapping.destinationKeyPath ofClass:object_getClass(self.destinationObject)];
+}
+
+- (id)destinationValueForPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping
+{
+    RKPropertyAccessor *propertyAccessor = [self destinationPropertyAccessorForPlannedMapping:plannedMapping];
+    if (propertyAccessor) return [propertyAccessor valueForObject:self.destinationObject];
+    return [self.destinationObject valueForKeyPath:plannedMapping.propertyMapping.destinationKeyPath];
+}
+
+- (void)setDestinationValue:(id)value forPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping
+{
+    RKPropertyAccessor *propertyAccessor = [self destinationPropertyAccessorForPlannedMapping:plannedMapping];
+    if (propertyAccessor) {
+        [propertyAccessor setValue:value forObject:self.destinationObject];
+    } else {
+        [self.destinationObject setValue:value forKeyPath:plannedMapping.propertyMapping.destinationKeyPath];
+    }
+}
+
 - (BOOL)validateValue:(id *)value atKeyPath:(NSString *)keyPath
 {
     BOOL success = YES;
@@ -339,8 +387,10 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return success;
 }
 
-- (BOOL)shouldSetValue:(id *)value forKeyPath:(NSString *)keyPath usingMapping:(RKPropertyMapping *)propertyMapping
+- (BOOL)shouldSetValue:(id *)value forPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping
 {
+    RKPropertyMapping *propertyMapping = plannedMapping.propertyMapping;
+    NSString *keyPath = propertyMapping.destinationKeyPath;
     if ([self.delegate respondsToSelector:@selector(mappingOperation:shouldSetValue:forKeyPath:usingMapping:)]) {
         return [self.delegate mappingOperation:self shouldSetValue:*value forKeyPath:keyPath usingMapping:propertyMapping];
     }
@@ -348,7 +398,7 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     // Always set the properties
     if ([self.dataSource respondsToSelector:@selector(mappingOperationShouldSetUnchangedValues:)] && [self.dataSource mappingOperationShouldSetUnchangedValues:self]) return YES;
     
-    id currentValue = [self.destinationObject valueForKeyPath:keyPath];
+    id currentValue = [self destinationValueForPlannedMapping:plannedMapping];
     if (currentValue == [NSNull null]) {
         currentValue = nil;
     }
@@ -377,63 +427,42 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return NO;
 }
 
-- (NSArray *)applyNestingToMappings:(NSArray *)propertyMappings
+// Replaces the plan compiled by the object mapping with one built from the nesting substituted property mappings
+- (void)applyNestingToMappingPlan
 {
+    if (! self.nestedAttributeSubstitution) return;
     NSString *attributeName = [[self.nestedAttributeSubstitution allKeys] lastObject];
     id value = [[self.nestedAttributeSubstitution allValues] lastObject];
-    return self.nestedAttributeSubstitution ? RKApplyNestingAttributeValueToMappings(attributeName, value, propertyMappings) : propertyMappings;
-}
-
-- (NSArray *)nestedAttributeMappings
-{
-    if (!_nestedAttributeMappings) _nestedAttributeMappings = [self applyNestingToMappings:self.objectMapping.attributeMappings];
-    return _nestedAttributeMappings;
+    NSMutableArray *propertyMappings = [NSMutableArray arrayWithArray:[self.mappingPlan.attributeMappings valueForKey:@"propertyMapping"]];
+    [propertyMappings addObjectsFromArray:[self.mappingPlan.relationshipMappings valueForKey:@"propertyMapping"]];
+    NSArray *nestedMappings = RKApplyNestingAttributeValueToMappings(attributeName, value, propertyMappings);
+    self.mappingPlan = [[RKObjectMappingPlan alloc] initWithObjectMapping:self.objectMapping propertyMappings:nestedMappings];
 }
 
-- (NSArray *)simpleAttributeMappings
+- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPlannedMapping:(RKPlannedPropertyMapping *)plannedMapping error:(NSError *__autoreleasing *)error
 {
-    NSMutableArray *mappings = [NSMutableArray array];
-    for (RKAttributeMapping *mapping in self.nestedAttributeMappings) {
-        if ([mapping.sourceKeyPath rangeOfString:@"."].location == NSNotFound) {
-            [mappings addObject:mapping];
-        }
-    }
-
-    return mappings;
-}
-
-- (NSArray *)keyPathAttributeMappings
-{
-    NSMutableArray *mappings = [NSMutableArray array];
-    for (RKAttributeMapping *mapping in self.nestedAttributeMappings) {
-        if ([mapping.sourceKeyPath rangeOfString:@"."].location != NSNotFound) {
-            [mappings addObject:mapping];
-        }
-    }
-
-    return mappings;
-}
-
-- (NSArray *)relationshipMappings
-{
-    return [self applyNestingToMappings:self.objectMapping.relationshipMappings];
-}
-
-- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPropertyMapping:(RKPropertyMapping *)propertyMapping error:(NSError *__autoreleasing *)error
-{
-    Class transformedValueClass = propertyMapping.propertyValueClass ?: [self.objectMapping classForKeyPath:propertyMapping.destinationKeyPath];
+    RKPropertyMapping *propertyMapping = plannedMapping.propertyMapping;
+    Class transformedValueClass = propertyMapping.propertyValueClass ?: plannedMapping.destinationClass;
     if (! transformedValueClass) {
         *outputValue = inputValue;
         return YES;
     }
     RKLogTrace(@"Found transformable value at keyPath '%@'. Transforming from class '%@' to '%@'", propertyMapping.sourceKeyPath, NSStringFromClass([inputValue class]), NSStringFromClass(transformedValueClass));
-    BOOL success = [propertyMapping.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
+    BOOL success;
+    if (self.synchronizesDateTransformations && ([transformedValueClass isSubclassOfClass:[NSDate class]] || [inputValue isKindOfClass:[NSDate class]])) {
+        @synchronized(RKDateTransformationLock()) {
+            success = [plannedMapping.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
+        }
+    } else {
+        success = [plannedMapping.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
+    }
     if (! success) RKLogError(@"Failed transformation of value at keyPath '%@' to representation of type '%@': %@", propertyMapping.sourceKeyPath, transformedValueClass, *error);
     return success;
 }
 
-- (void)applyAttributeMapping:(RKAttributeMapping *)attributeMapping withValue:(id)value
+- (void)applyAttributeMapping:(RKPlannedPropertyMapping *)plannedMapping withValue:(id)value
 {
+    RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plannedMapping.propertyMapping;
     if ([self.delegate respondsToSelector:@selector(mappingOperation:didFindValue:forKeyPath:mapping:)]) {
         [self.delegate mappingOperation:self didFindValue:value forKeyPath:attributeMapping.sourceKeyPath mapping:attributeMapping];
     }
@@ -441,26 +470,26 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 
     id transformedValue = nil;
     NSError *error = nil;
-    if (! [self transformValue:value toValue:&transformedValue withPropertyMapping:attributeMapping error:&error]) return;
+    if (! [self transformValue:value toValue:&transformedValue withPlannedMapping:plannedMapping error:&error]) return;
     
     // If we have a nil value for a primitive property, we need to coerce it into a KVC usable value or bail out
     if (transformedValue == nil && RKPropertyInspectorIsPropertyAtKeyPathOfObjectPrimitive(attributeMapping.destinationKeyPath, self.destinationObject)) {
         RKLogDebug(@"Detected `nil` value transformation for primitive property at keyPath '%@'", attributeMapping.destinationKeyPath);
-        transformedValue = RKPrimitiveValueForNilValueOfClass([self.objectMapping classForKeyPath:attributeMapping.destinationKeyPath]);
+        transformedValue = RKPrimitiveValueForNilValueOfClass(plannedMapping.destinationClass);
         if (! transformedValue) {
             RKLogTrace(@"Skipped mapping of attribute value from keyPath '%@ to keyPath '%@' -- Unable to transform `nil` into primitive value representation", attributeMapping.sourceKeyPath, attributeMapping.destinationKeyPath);
             return;
         }
     }
 
-    RKSetIntermediateDictionaryValuesOnObjectForKeyPath(self.destinationObject, attributeMapping.destinationKeyPath);
+    RKSetIntermediateDictionaryValuesOnObjectForKeyPathComponents(self.destinationObject, plannedMapping.destinationKeyPathComponents);
     
     // Ensure that the value is different
-    if ([self shouldSetValue:&transformedValue forKeyPath:attributeMapping.destinationKeyPath usingMapping:attributeMapping]) {
+    if ([self shouldSetValue:&transformedValue forPlannedMapping:plannedMapping]) {
         RKLogTrace(@"Mapped attribute value from keyPath '%@' to '%@'. Value: %@", attributeMapping.sourceKeyPath, attributeMapping.destinationKeyPath, transformedValue);
         
         if (attributeMapping.destinationKeyPath) {
-            [self.destinationObject setValue:transformedValue forKeyPath:attributeMapping.destinationKeyPath];
+            [self setDestinationValue:transformedValue forPlannedMapping:plannedMapping];
         } else {
             if ([self.destinationObject isKindOfClass:[NSMutableDictionary class]] && [transformedValue isKindOfClass:[NSDictionary class]]) {
                 [self.destinationObject setDictionary:transformedValue];
@@ -490,18 +519,19 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
         RKLogDebug(@"Key-value validation is disabled for mapping, skipping...");
     }
 
-    for (RKAttributeMapping *attributeMapping in attributeMappings) {
+    for (RKPlannedPropertyMapping *plannedMapping in attributeMappings) {
         if ([self isCancelled]) return NO;
 
-        if ([attributeMapping.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] || [attributeMapping.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
+        RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plannedMapping.propertyMapping;
+        if (plannedMapping.isNestingAttributeMapping) {
             RKLogTrace(@"Skipping attribute mapping for special keyPath '%@'", attributeMapping.sourceKeyPath);
             continue;
         }
 
-        id value = (attributeMapping.sourceKeyPath == nil) ? self.sourceObject : [self.sourceObject valueForKeyPath:attributeMapping.sourceKeyPath];
+        id value = (attributeMapping.sourceKeyPath == nil) ? self.sourceObject : [self sourceValueForPlannedMapping:plannedMapping];
         if (value) {
             appliedMappings = YES;
-            [self applyAttributeMapping:attributeMapping withValue:value];
+            [self applyAttributeMapping:plannedMapping withValue:value];
         } else {
             if ([self.delegate respondsToSelector:@selector(mappingOperation:didNotFindValueForKeyPath:mapping:)]) {
                 [self.delegate mappingOperation:self didNotFindValueForKeyPath:attributeMapping.sourceKeyPath mapping:attributeMapping];
@@ -523,8 +553,9 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return appliedMappings;
 }
 
-- (BOOL)mapNestedObject:(id)anObject toObject:(id)anotherObject withRelationshipMapping:(RKRelationshipMapping *)relationshipMapping metadata:(NSDictionary *)metadata
+- (BOOL)mapNestedObject:(id)anObject toObject:(id)anotherObject withRelationshipMapping:(RKPlannedPropertyMapping *)plannedMapping metadata:(NSDictionary *)metadata
 {
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plannedMapping.propertyMapping;
     NSAssert(anObject, @"Cannot map nested object without a nested source object");
     NSAssert(anotherObject, @"Cannot map nested object without a destination object");
     NSAssert(relationshipMapping, @"Cannot map a nested object relationship without a relationship mapping");
@@ -536,8 +567,9 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     subOperation.dataSource = self.dataSource;
     subOperation.delegate = self.delegate;
     subOperation.metadata = subOperationMetadata;
-    subOperation.parentSourceObject = [self parentObjectForRelationshipMapping:relationshipMapping];
+    subOperation.parentSourceObject = [self parentObjectForRelationshipMapping:plannedMapping];
     subOperation.rootSourceObject = self.rootSourceObject;
+    subOperation.synchronizesDateTransformations = self.synchronizesDateTransformations;
     [subOperation start];
     
     if (subOperation.error) {
@@ -569,8 +601,9 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return YES;
 }
 
-- (BOOL)mapOneToOneRelationshipWithValue:(id)value mapping:(RKRelationshipMapping *)relationshipMapping
+- (BOOL)mapOneToOneRelationshipWithValue:(id)value mapping:(RKPlannedPropertyMapping *)plannedMapping
 {
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plannedMapping.propertyMapping;
     // One to one relationship
     RKLogDebug(@"Mapping one to one relationship value at keyPath '%@' to '%@'", relationshipMapping.sourceKeyPath, relationshipMapping.destinationKeyPath);
     
@@ -580,16 +613,16 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
         return NO;
     }
 
-    id parentSourceObject = [self parentObjectForRelationshipMapping:relationshipMapping];
+    id parentSourceObject = [self parentObjectForRelationshipMapping:plannedMapping];
     id destinationObject = [self destinationObjectForMappingRepresentation:value parentRepresentation:parentSourceObject withMapping:relationshipMapping.mapping inRelationship:relationshipMapping];
     if (! destinationObject) {
         RKLogDebug(@"Mapping %@ declined mapping for representation %@: returned `nil` destination object.", relationshipMapping.mapping, destinationObject);
         return NO;
     }
-    [self mapNestedObject:value toObject:destinationObject withRelationshipMapping:relationshipMapping metadata:@{ @"mapping": @{ @"collectionIndex": [NSNull null] } }];
+    [self mapNestedObject:value toObject:destinationObject withRelationshipMapping:plannedMapping metadata:@{ @"mapping": @{ @"collectionIndex": [NSNull null] } }];
 
     // If the relationship has changed, set it
-    if ([self shouldSetValue:&destinationObject forKeyPath:relationshipMapping.destinationKeyPath usingMapping:relationshipMapping]) {
+    if ([self shouldSetValue:&destinationObject forPlannedMapping:plannedMapping]) {
         if (! [self applyReplaceAssignmentPolicyForRelationshipMapping:relationshipMapping]) {
             return NO;
         }
@@ -626,8 +659,9 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     return YES;
 }
 
-- (BOOL)mapOneToManyRelationshipWithValue:(id)value mapping:(RKRelationshipMapping *)relationshipMapping
+- (BOOL)mapOneToManyRelationshipWithValue:(id)value mapping:(RKPlannedPropertyMapping *)plannedMapping
 {
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plannedMapping.propertyMapping;
     // One to many relationship
     RKLogDebug(@"Mapping one to many relationship value at keyPath '%@' to '%@'", relationshipMapping.sourceKeyPath, relationshipMapping.destinationKeyPath);
 
@@ -652,10 +686,10 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     }
 
     [value enumerateObjectsUsingBlock:^(id nestedObject, NSUInteger collectionIndex, BOOL *stop) {
-        id parentSourceObject = [self parentObjectForRelationshipMapping:relationshipMapping];
+        id parentSourceObject = [self parentObjectForRelationshipMapping:plannedMapping];
         id mappableObject = [self destinationObjectForMappingRepresentation:nestedObject parentRepresentation:parentSourceObject withMapping:relationshipMapping.mapping inRelationship:relationshipMapping];
         if (mappableObject) {
-            if ([self mapNestedObject:nestedObject toObject:mappableObject withRelationshipMapping:relationshipMapping metadata:@{ @"mapping": @{ @"collectionIndex": @(collectionIndex) } }]) {
+            if ([self mapNestedObject:nestedObject toObject:mappableObject withRelationshipMapping:plannedMapping metadata:@{ @"mapping": @{ @"collectionIndex": @(collectionIndex) } }]) {
                 [relationshipCollection addObject:mappableObject];
             }
         } else {
@@ -665,10 +699,10 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 
     id valueForRelationship = nil;
     NSError *error = nil;
-    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPropertyMapping:relationshipMapping error:&error]) return NO;
+    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPlannedMapping:plannedMapping error:&error]) return NO;
 
     // If the relationship has changed, set it
-    if ([self shouldSetValue:&valueForRelationship forKeyPath:relationshipMapping.destinationKeyPath usingMapping:relationshipMapping]) {
+    if ([self shouldSetValue:&valueForRelationship forPlannedMapping:plannedMapping]) {
         if (! [self mapCoreDataToManyRelationshipValue:valueForRelationship withMapping:relationshipMapping]) {
             RKLogTrace(@"Mapped relationship object from keyPath '%@' to '%@'. Value: %@", relationshipMapping.sourceKeyPath, relationshipMapping.destinationKeyPath, valueForRelationship);
             [self.destinationObject setValue:valueForRelationship forKeyPath:relationshipMapping.destinationKeyPath];
@@ -689,12 +723,13 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     NSAssert(self.dataSource, @"Cannot perform relationship mapping without a data source");
     NSMutableArray *mappingsApplied = [NSMutableArray array];
 
-    for (RKRelationshipMapping *relationshipMapping in [self relationshipMappings]) {
+    for (RKPlannedPropertyMapping *plannedMapping in self.mappingPlan.relationshipMappings) {
         if ([self isCancelled]) return NO;
-        
+
+        RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plannedMapping.propertyMapping;
         id value = nil;
         if (relationshipMapping.sourceKeyPath) {
-            value = [self.sourceObject valueForKeyPath:relationshipMapping.sourceKeyPath];
+            value = [self sourceValueForPlannedMapping:plannedMapping];
         } else {
             // The nil source keyPath indicates that we want to map directly from the parent representation
             value = self.sourceObject;
@@ -728,8 +763,7 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 
         // nil out the property if necessary
         if (value == nil) {
-            Class relationshipClass = [self.objectMapping classForKeyPath:relationshipMapping.destinationKeyPath];
-            BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
+            BOOL mappingToCollection = RKClassIsCollection(plannedMapping.destinationClass);
             if (relationshipMapping.assignmentPolicy == RKUnionAssignmentPolicy && mappingToCollection) {
                 // Unioning `nil` with the existing value is functionally equivalent to doing nothing, so just continue
                 continue;
@@ -743,7 +777,7 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
                 }
             }
 
-            if ([self shouldSetValue:&value forKeyPath:relationshipMapping.destinationKeyPath usingMapping:relationshipMapping]) {
+            if ([self shouldSetValue:&value forPlannedMapping:plannedMapping]) {
                 RKLogTrace(@"Setting nil for relationship value at keyPath '%@'", relationshipMapping.sourceKeyPath);
                 [self.destinationObject setValue:value forKeyPath:relationshipMapping.destinationKeyPath];
             }
@@ -768,7 +802,7 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
         }
 
         // Handle case where incoming content is a single object, but we want a collection
-        Class relationshipClass = [self.objectMapping classForKeyPath:relationshipMapping.destinationKeyPath];
+        Class relationshipClass = plannedMapping.destinationClass;
         BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
         if (mappingToCollection && !RKObjectIsCollection(value)) {
             Class orderedSetClass = NSClassFromString(@"NSOrderedSet");
@@ -786,9 +820,9 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 
         BOOL setValueForRelationship;
         if (RKObjectIsCollection(value)) {
-            setValueForRelationship = [self mapOneToManyRelationshipWithValue:value mapping:relationshipMapping];
+            setValueForRelationship = [self mapOneToManyRelationshipWithValue:value mapping:plannedMapping];
         } else {
-            setValueForRelationship = [self mapOneToOneRelationshipWithValue:value mapping:relationshipMapping];
+            setValueForRelationship = [self mapOneToOneRelationshipWithValue:value mapping:plannedMapping];
         }
 
         if (! setValueForRelationship) continue;
@@ -808,21 +842,22 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
 
 - (void)applyNestedMappings
 {
-    RKAttributeMapping *attributeMapping = [self.objectMapping mappingForSourceKeyPath:RKObjectMappingNestingAttributeKeyName];
+    RKPlannedPropertyMapping *plannedMapping = [self.mappingPlan plannedMappingForSourceKeyPath:RKObjectMappingNestingAttributeKeyName];
+    RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plannedMapping.propertyMapping;
     if (attributeMapping) {
         RKLogDebug(@"Found nested mapping definition to attribute '%@'", attributeMapping.destinationKeyPath);
         id attributeValue = [[self.sourceObject allKeys] lastObject];
         if (attributeValue) {
             RKLogDebug(@"Found nesting value of '%@' for attribute '%@'", attributeValue, attributeMapping.destinationKeyPath);
             self.nestedAttributeSubstitution = @{ attributeMapping.destinationKeyPath: attributeValue };
-            [self applyAttributeMapping:attributeMapping withValue:attributeValue];
+            [self applyAttributeMapping:plannedMapping withValue:attributeValue];
         } else {
             RKLogWarning(@"Unable to find nesting value for attribute '%@'", attributeMapping.destinationKeyPath);
         }
     }
     
     // Serialization
-    attributeMapping = [self.objectMapping mappingForDestinationKeyPath:RKObjectMappingNestingAttributeKeyName];
+    attributeMapping = (RKAttributeMapping *)[self.mappingPlan plannedMappingForDestinationKeyPath:RKObjectMappingNestingAttributeKeyName].propertyMapping;
     if (attributeMapping) {
         RKLogDebug(@"Found nested mapping definition to attribute '%@'", attributeMapping.destinationKeyPath);
         id attributeValue = [self.sourceObject valueForKeyPath:attributeMapping.sourceKeyPath];
@@ -833,6 +868,8 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
             RKLogWarning(@"Unable to find nesting value for attribute '%@'", attributeMapping.destinationKeyPath);
         }
     }
+
+    [self applyNestingToMappingPlan];
 }
 
 - (void)cancel
@@ -846,6 +883,7 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
     if ([self isCancelled]) return;
 
     // Handle metadata
+    self.sourceRepresentation = self.sourceObject;
     self.sourceObject = [[RKMappingSourceObject alloc] initWithObject:self.sourceObject parentObject:self.parentSourceObject rootObject:self.rootSourceObject metadata:self.metadata];
 
     RKLogDebug(@"Starting mapping operation...");
@@ -880,16 +918,18 @@ static NSString *const RKRootKeyPathPrefix = @"@root.";
         self.mappingInfo = [[RKMappingInfo alloc] initWithObjectMapping:self.objectMapping dynamicMapping:nil];
     }
     
+    self.mappingPlan = [self.objectMapping mappingPlan];
+
     BOOL canSkipMapping = [self.dataSource respondsToSelector:@selector(mappingOperationShouldSkipPropertyMapping:)] && [self.dataSource mappingOperationShouldSkipPropertyMapping:self];
     if (! canSkipMapping) {
         [self applyNestedMappings];
         if ([self isCancelled]) return;
-        BOOL mappedSimpleAttributes = [self applyAttributeMappings:[self simpleAttributeMappings]];
+        BOOL mappedSimpleAttributes = [self applyAttributeMappings:self.mappingPlan.simpleAttributeMappings];
         if ([self isCancelled]) return;
-        BOOL mappedRelationships = [[self relationshipMappings] count] ? [self applyRelationshipMappings] : NO;
+        BOOL mappedRelationships = [self.mappingPlan.relationshipMappings count] ? [self applyRelationshipMappings] : NO;
         if ([self isCancelled]) return;
         // NOTE: We map key path attributes last to allow you to map across the object graphs for objects created/updated by the relationship mappings
-        BOOL mappedKeyPathAttributes = [self applyAttributeMappings:[self keyPathAttributeMappings]];
+        BOOL mappedKeyPathAttributes = [self applyAttributeMappings:self.mappingPlan.keyPathAttributeMappings];
         
         if (!mappedSimpleAttributes && !mappedRelationships && !mappedKeyPathAttributes) {
             // We did not find anything to do
@@ -20,7 +20,7 @@
 
 #import <Foundation/Foundation.h>
 
-@class RKObjectMapping, RKMappingOperation, RKRelationshipMapping;
+@class RKMapping, RKObjectMapping, RKMappingOperation, RKRelationshipMapping;
 
 /**
  An object that adopts the `RKMappingOperationDataSource` protocol is responsible for the retrieval or creation of target objects within an `RKMapperOperation` or `RKMappingOperation`. A data source is responsible for meeting the requirements of the underlying data store implementation and must return a key-value coding compliant object instance that can be used as the target object of a mapping operation. It is also responsible for commiting any changes necessary to the underlying data store once a mapping operation has completed its work.
@@ -78,4 +78,24 @@
 
 - (BOOL)mappingOperationShouldSkipPropertyMapping:(RKMappingOperation *)mappingOperation;
 
+/**
+ Tells the data source that a collection of object representations is about to be mapped with the given mapping.
+
+ The data source may use this opportunity to retrieve the target objects for the entire collection at once, rather than one representation at a time as `mappingOperation:targetObjectForRepresentation:withMapping:inRelationship:` is invoked for each of them.
+
+ @param representations The array of object representations that are about to be mapped.
+ @param mapping The mapping with which the representations will be mapped.
+ */
+- (void)prepareTargetObjectsForRepresentations:(NSArray *)representations withMapping:(RKMapping *)mapping;
+
+/**
+ Tells the data source that a collection of object representations previously passed to `prepareTargetObjectsForRepresentations:withMapping:` has been mapped.
+
+ The data source should discard any target objects it retained while preparing the collection so that they do not outlive the mapping of that collection.
+
+ @param representations The array of object representations that were mapped.
+ @param mapping The mapping with which the representations were mapped.
+ */
+- (void)didMapRepresentations:(NSArray *)representations withMapping:(RKMapping *)mapping;
+
 @end
@@ -26,6 +26,7 @@
 #import "RKAttributeMapping.h"
 #import "RKRelationshipMapping.h"
 #import "RKValueTransformers.h"
+#import "RKObjectMappingPlan.h"
 #import "ISO8601DateFormatterValueTransformer.h"
 
 typedef NSString * (^RKSourceToDesinationKeyTransformationBlock)(RKObjectMapping *, NSString *);
@@ -103,9 +104,11 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
 @interface RKObjectMapping ()
 @property (nonatomic, weak, readwrite) Class objectClass;
 @property (nonatomic, strong) NSMutableArray *mutablePropertyMappings;
+@property (nonatomic, strong) NSCountedSet *mutableDestinationKeyPaths;
 
 @property (nonatomic, weak, readonly) NSArray *mappedKeyPaths;
 @property (nonatomic, copy) RKSourceToDesinationKeyTransformationBlock sourceToDestinationKeyTransformationBlock;
+@property (atomic, strong) RKObjectMappingPlan *cachedMappingPlan;
 @end
 
 @implementation RKObjectMapping
@@ -182,70 +185,53 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
     defaultSourceToDestinationKeyTransformationBlock = block;
 }
 
+- (void)setMutablePropertyMappings:(NSMutableArray *)mutablePropertyMappings
+{
+    _mutablePropertyMappings = mutablePropertyMappings;
+    self.mutableDestinationKeyPaths = [NSCountedSet setWithArray:[mutablePropertyMappings valueForKey:@"destinationKeyPath"]];
+    [self invalidateMappingPlan];
+}
+
 - (NSArray *)propertyMappings
 {
-    return [NSArray arrayWithArray:_mutablePropertyMappings];
+    return [self mappingPlan].propertyMappings;
 }
 
 - (NSDictionary *)propertyMappingsBySourceKeyPath
 {
-    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[self.propertyMappings count]];
-    for (RKPropertyMapping *propertyMapping in self.propertyMappings) {
-        if (! propertyMapping.sourceKeyPath) continue;
-        [dictionary setObject:propertyMapping forKey:propertyMapping.sourceKeyPath];
-    }
-    
-    return dictionary;
+    return [self mappingPlan].propertyMappingsBySourceKeyPath;
 }
 
 - (NSDictionary *)propertyMappingsByDestinationKeyPath
 {
-    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[self.propertyMappings count]];
-    for (RKPropertyMapping *propertyMapping in self.propertyMappings) {
-        if (! propertyMapping.destinationKeyPath) continue;
-        [dictionary setObject:propertyMapping forKey:propertyMapping.destinationKeyPath];
-    }
-    
-    return dictionary;
+    return [self mappingPlan].propertyMappingsByDestinationKeyPath;
 }
 
 - (NSArray *)mappedKeyPaths
 {
-    return [self.propertyMappings valueForKey:@"destinationKeyPath"];
+    return [self mappingPlan].mappedKeyPaths;
 }
 
 - (NSArray *)attributeMappings
 {
-    NSMutableArray *mappings = [NSMutableArray array];
-    for (RKAttributeMapping *mapping in self.propertyMappings) {
-        if ([mapping isMemberOfClass:[RKAttributeMapping class]]) {
-            [mappings addObject:mapping];
-        }
-    }
-
-    return mappings;
+    return [self mappingPlan].attributePropertyMappings;
 }
 
 - (NSArray *)relationshipMappings
 {
-    NSMutableArray *mappings = [NSMutableArray array];
-    for (RKAttributeMapping *mapping in self.propertyMappings) {
-        if ([mapping isMemberOfClass:[RKRelationshipMapping class]]) {
-            [mappings addObject:mapping];
-        }
-    }
-
-    return mappings;
+    return [self mappingPlan].relationshipPropertyMappings;
 }
 
 - (void)addPropertyMapping:(RKPropertyMapping *)propertyMapping
 {
-    NSAssert1([[self mappedKeyPaths] containsObject:propertyMapping.destinationKeyPath] == NO,
+    NSAssert1(! propertyMapping.destinationKeyPath || [self.mutableDestinationKeyPaths countForObject:propertyMapping.destinationKeyPath] == 0,
               @"Unable to add mapping for keyPath %@, one already exists...", propertyMapping.destinationKeyPath);
     NSAssert(self.mutablePropertyMappings, @"self.mutablePropertyMappings is nil");
     NSAssert(propertyMapping.objectMapping == nil, @"Cannot add a property mapping object that has already been added to another `RKObjectMapping` object. You probably want to obtain a copy of the mapping: `[propertyMapping copy]`");
     propertyMapping.objectMapping = self;
     [self.mutablePropertyMappings addObject:propertyMapping];
+    if (propertyMapping.destinationKeyPath) [self.mutableDestinationKeyPaths addObject:propertyMapping.destinationKeyPath];
+    [self invalidateMappingPlan];
 }
 
 - (void)addPropertyMappingsFromArray:(NSArray *)arrayOfPropertyMappings
@@ -264,24 +250,12 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
 
 - (id)mappingForSourceKeyPath:(NSString *)sourceKeyPath
 {
-    for (RKPropertyMapping *mapping in self.propertyMappings) {
-        if ([mapping.sourceKeyPath isEqualToString:sourceKeyPath]) {
-            return mapping;
-        }
-    }
-
-    return nil;
+    return [[self mappingPlan] plannedMappingForSourceKeyPath:sourceKeyPath].propertyMapping;
 }
 
 - (id)mappingForDestinationKeyPath:(NSString *)destinationKeyPath
 {
-    for (RKPropertyMapping *mapping in self.propertyMappings) {
-        if ([mapping.destinationKeyPath isEqualToString:destinationKeyPath]) {
-            return mapping;
-        }
-    }
-
-    return nil;
+    return [[self mappingPlan] plannedMappingForDestinationKeyPath:destinationKeyPath].propertyMapping;
 }
 
 // Evaluate each component individually so that camelization, etc. considers each component individually
@@ -338,6 +312,8 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
     if ([self.mutablePropertyMappings containsObject:attributeOrRelationshipMapping]) {
         attributeOrRelationshipMapping.objectMapping = nil;
         [self.mutablePropertyMappings removeObject:attributeOrRelationshipMapping];
+        if (attributeOrRelationshipMapping.destinationKeyPath) [self.mutableDestinationKeyPaths removeObject:attributeOrRelationshipMapping.destinationKeyPath];
+        [self invalidateMappingPlan];
     }
 }
 
@@ -352,6 +328,30 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
     return [self inverseMappingWithPropertyMappingsPassingTest:nil];
 }
 
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    _valueTransformer = valueTransformer;
+    [self invalidateMappingPlan];
+}
+
+#pragma mark - Mapping Plan
+
+- (RKObjectMappingPlan *)mappingPlan
+{
+    // NOTE: Concurrent callers may race to build the plan, but each builds an equivalent immutable plan
+    RKObjectMappingPlan *mappingPlan = self.cachedMappingPlan;
+    if (! mappingPlan) {
+        mappingPlan = [[RKObjectMappingPlan alloc] initWithObjectMapping:self propertyMappings:_mutablePropertyMappings];
+        self.cachedMappingPlan = mappingPlan;
+    }
+    return mappingPlan;
+}
+
+- (void)invalidateMappingPlan
+{
+    self.cachedMappingPlan = nil;
+}
+
 - (void)addAttributeMappingFromKeyOfRepresentationToAttribute:(NSString *)attributeName
 {
     [self addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:RKObjectMappingNestingAttributeKeyName toKeyPath:attributeName]];
@@ -364,24 +364,12 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
 
 - (RKAttributeMapping *)mappingForAttribute:(NSString *)attributeKey
 {
-    for (RKAttributeMapping *mapping in [self attributeMappings]) {
-        if ([mapping.destinationKeyPath isEqualToString:attributeKey]) {
-            return mapping;
-        }
-    }
-
-    return nil;
+    return [[self mappingPlan] attributeMappingForDestinationKeyPath:attributeKey];
 }
 
 - (RKRelationshipMapping *)mappingForRelationship:(NSString *)relationshipKey
 {
-    for (RKRelationshipMapping *mapping in [self relationshipMappings]) {
-        if ([mapping.destinationKeyPath isEqualToString:relationshipKey]) {
-            return mapping;
-        }
-    }
-
-    return nil;
+    return [[self mappingPlan] relationshipMappingForDestinationKeyPath:relationshipKey];
 }
 
 - (id)defaultValueForAttribute:(NSString *)attributeName
@@ -0,0 +1,184 @@
+//
+//  RKObjectMappingPlan.h
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKObjectMapping.h"
+
+@protocol RKValueTransforming;
+
+/**
+ An `RKPlannedPropertyMapping` object holds the details of a single `RKPropertyMapping` that are invariant across mapping operations, so that they are computed once per object mapping rather than once per mapped object.
+ */
+@interface RKPlannedPropertyMapping : NSObject
+
+/**
+ The property mapping that was planned.
+ */
+@property (nonatomic, strong, readonly) RKPropertyMapping *propertyMapping;
+
+/**
+ The components of the source key path of the property mapping split on the dot separator, or `nil` if the source key path is `nil`.
+ */
+@property (nonatomic, copy, readonly) NSArray *sourceKeyPathComponents;
+
+/**
+ The components of the destination key path of the property mapping split on the dot separator, or `nil` if the destination key path is `nil`.
+ */
+@property (nonatomic, copy, readonly) NSArray *destinationKeyPathComponents;
+
+/**
+ The class of the property at the destination key path as returned by `[RKObjectMapping classForKeyPath:]`, or `Nil` if it could not be determined.
+ */
+@property (nonatomic, strong, readonly) Class destinationClass;
+
+/**
+ The value transformer of the property mapping, resolved against the value transformer of the object mapping.
+ */
+@property (nonatomic, strong, readonly) id<RKValueTransforming> valueTransformer;
+
+/**
+ A Boolean value that indicates if the source value can be read from the representation with `sourceValueFromRepresentation:`. This is `NO` if the source key path is `nil` or if its first component begins with `@`, such as `@metadata`, `@parent` or `@root`, which must be resolved by the mapping operation.
+ */
+@property (nonatomic, assign, readonly) BOOL readsSourceValueDirectly;
+
+/**
+ Returns the value at the source key path of the given representation by walking the precomputed key path components. `NSDictionary` nodes are read with `objectForKey:` and `NSArray` nodes are mapped element-wise, so the key path is not parsed and dispatched through key-value coding for each mapped object. Key-value coding collection operators such as `@unionOfArrays` and any components that follow them are evaluated with `valueForKeyPath:` as a fallback.
+
+ @param representation The object representation to read the source value from.
+ @return The value at the source key path of the representation.
+ @warning Raises an `NSInternalInconsistencyException` if `readsSourceValueDirectly` is `NO`.
+ */
+- (id)sourceValueFromRepresentation:(id)representation;
+
+/**
+ A Boolean value that indicates if the property mapping reads or writes the special nesting attribute key.
+ */
+@property (nonatomic, assign, readonly, getter = isNestingAttributeMapping) BOOL nestingAttributeMapping;
+
+@end
+
+/**
+ An `RKObjectMappingPlan` is an immutable, precompiled form of the property mappings of an `RKObjectMapping`. It is built lazily by the object mapping the first time it is requested and discarded whenever a property mapping is added or removed, so the partitioning and introspection work performed by `RKMappingOperation` is paid once per mapping instead of once per mapped object.
+
+ The plan also indexes the property mappings themselves, and backs the `propertyMappings`, `attributeMappings`, `relationshipMappings` and lookup methods of `RKObjectMapping`, so repeated queries of an object mapping do not allocate.
+ */
+@interface RKObjectMappingPlan : NSObject
+
+/**
+ Initializes the receiver with the property mappings of the given object mapping.
+
+ @param objectMapping The object mapping to compile.
+ @return The receiver, initialized with the property mappings of the given object mapping.
+ */
+- (id)initWithObjectMapping:(RKObjectMapping *)objectMapping;
+
+/**
+ Initializes the receiver with an explicit array of property mappings, resolving destination classes against the given object mapping. This is used to plan the ad-hoc property mappings produced by nesting attribute substitution.
+
+ @param objectMapping The object mapping against which destination classes are resolved.
+ @param propertyMappings An array of `RKAttributeMapping` and `RKRelationshipMapping` objects.
+ @return The receiver, initialized with the given property mappings.
+ */
+- (id)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings;
+
+/**
+ All planned attribute mappings, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *attributeMappings;
+
+/**
+ Planned attribute mappings whose source key path is a single key.
+ */
+@property (nonatomic, copy, readonly) NSArray *simpleAttributeMappings;
+
+/**
+ Planned attribute mappings whose source key path traverses the object graph (or is `nil`).
+ */
+@property (nonatomic, copy, readonly) NSArray *keyPathAttributeMappings;
+
+/**
+ All planned relationship mappings, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *relationshipMappings;
+
+/**
+ Returns the planned mapping with the given source key path, if any.
+ */
+- (RKPlannedPropertyMapping *)plannedMappingForSourceKeyPath:(NSString *)sourceKeyPath;
+
+/**
+ Returns the planned mapping with the given destination key path, if any.
+ */
+- (RKPlannedPropertyMapping *)plannedMappingForDestinationKeyPath:(NSString *)destinationKeyPath;
+
+/**
+ The property mappings the receiver was planned from, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *propertyMappings;
+
+/**
+ The `RKAttributeMapping` objects among the property mappings, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *attributePropertyMappings;
+
+/**
+ The `RKRelationshipMapping` objects among the property mappings, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *relationshipPropertyMappings;
+
+/**
+ The destination key paths of the property mappings, in the order they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *mappedKeyPaths;
+
+/**
+ A dictionary of the property mappings keyed by source key path. The last mapping added for a key path wins.
+ */
+@property (nonatomic, copy, readonly) NSDictionary *propertyMappingsBySourceKeyPath;
+
+/**
+ A dictionary of the property mappings keyed by destination key path. The last mapping added for a key path wins.
+ */
+@property (nonatomic, copy, readonly) NSDictionary *propertyMappingsByDestinationKeyPath;
+
+/**
+ Returns the first attribute mapping with the given destination key path, if any.
+ */
+- (RKAttributeMapping *)attributeMappingForDestinationKeyPath:(NSString *)destinationKeyPath;
+
+/**
+ Returns the first relationship mapping with the given destination key path, if any.
+ */
+- (RKRelationshipMapping *)relationshipMappingForDestinationKeyPath:(NSString *)destinationKeyPath;
+
+@end
+
+@interface RKObjectMapping (RKObjectMappingPlan)
+
+/**
+ Returns the compiled mapping plan for the receiver, building it if necessary. The plan is invalidated when property mappings are added to or removed from the receiver.
+ */
+- (RKObjectMappingPlan *)mappingPlan;
+
+/**
+ Discards the compiled mapping plan of the receiver so that it is rebuilt on next access.
+ */
+- (void)invalidateMappingPlan;
+
+@end
@@ -0,0 +1,226 @@
+//
+//  RKObjectMappingPlan.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKObjectMappingPlan.h"
+#import "RKAttributeMapping.h"
+#import "RKRelationshipMapping.h"
+#import "RKValueTransformers.h"
+
+extern NSString * const RKObjectMappingNestingAttributeKeyName;
+
+/**
+ Returns the value for a single key of a representation node. Dictionaries are read with `objectForKey:`, which is equivalent to `valueForKey:` for keys that do not begin with `@`. Arrays are mapped element-wise with `NSNull` standing in for `nil`, matching `-[NSArray valueForKey:]`. All other objects fall back to `valueForKey:`.
+ */
+static id RKValueForKeyOfRepresentation(NSString *key, id representation)
+{
+    if ([representation isKindOfClass:[NSDictionary class]]) return [representation objectForKey:key];
+    if ([representation isKindOfClass:[NSArray class]]) {
+        NSMutableArray *values = [NSMutableArray arrayWithCapacity:[representation count]];
+        for (id element in representation) {
+            id value = RKValueForKeyOfRepresentation(key, element);
+            [values addObject:value ?: [NSNull null]];
+        }
+        return values;
+    }
+    return [representation valueForKey:key];
+}
+
+@interface RKPlannedPropertyMapping ()
+@property (nonatomic, strong, readwrite) RKPropertyMapping *propertyMapping;
+@property (nonatomic, copy, readwrite) NSArray *sourceKeyPathComponents;
+@property (nonatomic, copy, readwrite) NSArray *destinationKeyPathComponents;
+@property (nonatomic, strong, readwrite) Class destinationClass;
+@property (nonatomic, strong, readwrite) id<RKValueTransforming> valueTransformer;
+@property (nonatomic, assign, readwrite) BOOL readsSourceValueDirectly;
+@property (nonatomic, assign, readwrite, getter = isNestingAttributeMapping) BOOL nestingAttributeMapping;
+@property (nonatomic, copy) NSArray *directSourceKeyPathComponents;
+@property (nonatomic, copy) NSString *sourceKeyPathOperatorSuffix;
+
+- (id)initWithPropertyMapping:(RKPropertyMapping *)propertyMapping objectMapping:(RKObjectMapping *)objectMapping;
+@end
+
+@implementation RKPlannedPropertyMapping
+
+- (id)initWithPropertyMapping:(RKPropertyMapping *)propertyMapping objectMapping:(RKObjectMapping *)objectMapping
+{
+    self = [super init];
+    if (self) {
+        self.propertyMapping = propertyMapping;
+        self.sourceKeyPathComponents = [propertyMapping.sourceKeyPath componentsSeparatedByString:@"."];
+        self.destinationKeyPathComponents = [propertyMapping.destinationKeyPath componentsSeparatedByString:@"."];
+        self.destinationClass = [objectMapping classForKeyPath:propertyMapping.destinationKeyPath];
+        self.valueTransformer = propertyMapping.valueTransformer;
+
+        // Split the source key path at the first `@` component: everything before it is walked directly and the remainder is evaluated with KVC
+        NSUInteger operatorIndex = [self.sourceKeyPathComponents indexOfObjectPassingTest:^BOOL(NSString *component, NSUInteger idx, BOOL *stop) {
+            return [component hasPrefix:@"@"];
+        }];
+        if (operatorIndex == NSNotFound) {
+            self.directSourceKeyPathComponents = self.sourceKeyPathComponents;
+        } else if (operatorIndex > 0) {
+            NSRange operatorRange = NSMakeRange(operatorIndex, [self.sourceKeyPathComponents count] - operatorIndex);
+            self.directSourceKeyPathComponents = [self.sourceKeyPathComponents subarrayWithRange:NSMakeRange(0, operatorIndex)];
+            self.sourceKeyPathOperatorSuffix = [[self.sourceKeyPathComponents subarrayWithRange:operatorRange] componentsJoinedByString:@"."];
+        }
+        self.readsSourceValueDirectly = ([self.directSourceKeyPathComponents count] > 0);
+        self.nestingAttributeMapping = [propertyMapping.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] || [propertyMapping.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName];
+    }
+
+    return self;
+}
+
+- (id)sourceValueFromRepresentation:(id)representation
+{
+    NSAssert(self.readsSourceValueDirectly, @"Cannot read the source value of a property mapping with source key path '%@' directly", self.propertyMapping.sourceKeyPath);
+    id value = representation;
+    for (NSString *key in self.directSourceKeyPathComponents) {
+        if (value == nil) return nil;
+        value = RKValueForKeyOfRepresentation(key, value);
+    }
+    if (self.sourceKeyPathOperatorSuffix) value = [value valueForKeyPath:self.sourceKeyPathOperatorSuffix];
+    return value;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@ destinationClass=%@>", NSStringFromClass([self class]), self, self.propertyMapping, NSStringFromClass(self.destinationClass)];
+}
+
+@end
+
+@interface RKObjectMappingPlan ()
+@property (nonatomic, copy, readwrite) NSArray *attributeMappings;
+@property (nonatomic, copy, readwrite) NSArray *simpleAttributeMappings;
+@property (nonatomic, copy, readwrite) NSArray *keyPathAttributeMappings;
+@property (nonatomic, copy, readwrite) NSArray *relationshipMappings;
+@property (nonatomic, copy) NSDictionary *plannedMappingsBySourceKeyPath;
+@property (nonatomic, copy) NSDictionary *plannedMappingsByDestinationKeyPath;
+@property (nonatomic, copy, readwrite) NSArray *propertyMappings;
+@property (nonatomic, copy, readwrite) NSArray *attributePropertyMappings;
+@property (nonatomic, copy, readwrite) NSArray *relationshipPropertyMappings;
+@property (nonatomic, copy, readwrite) NSArray *mappedKeyPaths;
+@property (nonatomic, copy, readwrite) NSDictionary *propertyMappingsBySourceKeyPath;
+@property (nonatomic, copy, readwrite) NSDictionary *propertyMappingsByDestinationKeyPath;
+@property (nonatomic, copy) NSDictionary *attributeMappingsByDestinationKeyPath;
+@property (nonatomic, copy) NSDictionary *relationshipMappingsByDestinationKeyPath;
+@end
+
+static void RKSetObjectForKeyIfAbsent(NSMutableDictionary *dictionary, id object, id<NSCopying> key)
+{
+    if (key && ! [dictionary objectForKey:key]) [dictionary setObject:object forKey:key];
+}
+
+@implementation RKObjectMappingPlan
+
+- (id)initWithObjectMapping:(RKObjectMapping *)objectMapping
+{
+    return [self initWithObjectMapping:objectMapping propertyMappings:objectMapping.propertyMappings];
+}
+
+- (id)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings
+{
+    self = [super init];
+    if (self) {
+        NSMutableArray *attributeMappings = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *simpleAttributeMappings = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *keyPathAttributeMappings = [NSMutableArray array];
+        NSMutableArray *relationshipMappings = [NSMutableArray array];
+        NSMutableDictionary *plannedMappingsBySourceKeyPath = [NSMutableDictionary dictionaryWithCapacity:[propertyMappings count]];
+        NSMutableDictionary *plannedMappingsByDestinationKeyPath = [NSMutableDictionary dictionaryWithCapacity:[propertyMappings count]];
+        NSMutableArray *attributePropertyMappings = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *relationshipPropertyMappings = [NSMutableArray array];
+        NSMutableDictionary *propertyMappingsBySourceKeyPath = [NSMutableDictionary dictionaryWithCapacity:[propertyMappings count]];
+        NSMutableDictionary *propertyMappingsByDestinationKeyPath = [NSMutableDictionary dictionaryWithCapacity:[propertyMappings count]];
+        NSMutableDictionary *attributeMappingsByDestinationKeyPath = [NSMutableDictionary dictionaryWithCapacity:[propertyMappings count]];
+        NSMutableDictionary *relationshipMappingsByDestinationKeyPath = [NSMutableDictionary dictionary];
+
+        for (RKPropertyMapping *propertyMapping in propertyMappings) {
+            RKPlannedPropertyMapping *plannedMapping = [[RKPlannedPropertyMapping alloc] initWithPropertyMapping:propertyMapping objectMapping:objectMapping];
+            if ([propertyMapping isMemberOfClass:[RKAttributeMapping class]]) {
+                [attributePropertyMappings addObject:propertyMapping];
+                RKSetObjectForKeyIfAbsent(attributeMappingsByDestinationKeyPath, propertyMapping, propertyMapping.destinationKeyPath);
+                [attributeMappings addObject:plannedMapping];
+                // NOTE: A `nil` source key path is treated as a key path mapping so that it is applied after relationships
+                if (propertyMapping.sourceKeyPath && [plannedMapping.sourceKeyPathComponents count] == 1) {
+                    [simpleAttributeMappings addObject:plannedMapping];
+                } else {
+                    [keyPathAttributeMappings addObject:plannedMapping];
+                }
+            } else if ([propertyMapping isMemberOfClass:[RKRelationshipMapping class]]) {
+                [relationshipPropertyMappings addObject:propertyMapping];
+                RKSetObjectForKeyIfAbsent(relationshipMappingsByDestinationKeyPath, propertyMapping, propertyMapping.destinationKeyPath);
+                [relationshipMappings addObject:plannedMapping];
+            }
+
+            // The first mapping wins to match the linear search performed by `mappingForSourceKeyPath:`
+            RKSetObjectForKeyIfAbsent(plannedMappingsBySourceKeyPath, plannedMapping, propertyMapping.sourceKeyPath);
+            RKSetObjectForKeyIfAbsent(plannedMappingsByDestinationKeyPath, plannedMapping, propertyMapping.destinationKeyPath);
+
+            // The last mapping wins in the dictionaries exposed by `RKObjectMapping`
+            if (propertyMapping.sourceKeyPath) [propertyMappingsBySourceKeyPath setObject:propertyMapping forKey:propertyMapping.sourceKeyPath];
+            if (propertyMapping.destinationKeyPath) [propertyMappingsByDestinationKeyPath setObject:propertyMapping forKey:propertyMapping.destinationKeyPath];
+        }
+
+        self.attributeMappings = attributeMappings;
+        self.simpleAttributeMappings = simpleAttributeMappings;
+        self.keyPathAttributeMappings = keyPathAttributeMappings;
+        self.relationshipMappings = relationshipMappings;
+        self.plannedMappingsBySourceKeyPath = plannedMappingsBySourceKeyPath;
+        self.plannedMappingsByDestinationKeyPath = plannedMappingsByDestinationKeyPath;
+        self.propertyMappings = propertyMappings;
+        self.attributePropertyMappings = attributePropertyMappings;
+        self.relationshipPropertyMappings = relationshipPropertyMappings;
+        self.mappedKeyPaths = [propertyMappings valueForKey:@"destinationKeyPath"];
+        self.propertyMappingsBySourceKeyPath = propertyMappingsBySourceKeyPath;
+        self.propertyMappingsByDestinationKeyPath = propertyMappingsByDestinationKeyPath;
+        self.attributeMappingsByDestinationKeyPath = attributeMappingsByDestinationKeyPath;
+        self.relationshipMappingsByDestinationKeyPath = relationshipMappingsByDestinationKeyPath;
+    }
+
+    return self;
+}
+
+- (RKPlannedPropertyMapping *)plannedMappingForSourceKeyPath:(NSString *)sourceKeyPath
+{
+    return sourceKeyPath ? [self.plannedMappingsBySourceKeyPath objectForKey:sourceKeyPath] : nil;
+}
+
+- (RKPlannedPropertyMapping *)plannedMappingForDestinationKeyPath:(NSString *)destinationKeyPath
+{
+    return destinationKeyPath ? [self.plannedMappingsByDestinationKeyPath objectForKey:destinationKeyPath] : nil;
+}
+
+- (RKAttributeMapping *)attributeMappingForDestinationKeyPath:(NSString *)destinationKeyPath
+{
+    return destinationKeyPath ? [self.attributeMappingsByDestinationKeyPath objectForKey:destinationKeyPath] : nil;
+}
+
+- (RKRelationshipMapping *)relationshipMappingForDestinationKeyPath:(NSString *)destinationKeyPath
+{
+    return destinationKeyPath ? [self.relationshipMappingsByDestinationKeyPath objectForKey:destinationKeyPath] : nil;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p simpleAttributeMappings=%@ keyPathAttributeMappings=%@ relationshipMappings=%@>",
+            NSStringFromClass([self class]), self, self.simpleAttributeMappings, self.keyPathAttributeMappings, self.relationshipMappings];
+}
+
+@end
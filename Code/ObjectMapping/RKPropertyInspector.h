@@ -43,6 +43,88 @@ extern NSString * const RKPropertyInspectionKeyValueCodingClassKey;
  */
 extern NSString * const RKPropertyInspectionIsPrimitiveKey;
 
+/**
+ The `RKPropertyInspection` class describes a single property inspected by an `RKPropertyInspector`. Inspections are immutable and are shared between all callers once a class has been inspected.
+
+ For compatibility with earlier releases, in which each property was described by a dictionary, the details of the inspection can also be retrieved with `objectForKey:` and keyed subscripting using the property inspection dictionary keys.
+ */
+@interface RKPropertyInspection : NSObject
+
+/**
+ Initializes the receiver with the details of an inspected property.
+
+ @param name The name of the property.
+ @param keyValueCodingClass The class used for key-value coding access to the property.
+ @param isPrimitive A Boolean value that indicates if the property is a primitive (non-object) value.
+ @return The receiver, initialized with the given property details.
+ */
+- (id)initWithName:(NSString *)name keyValueCodingClass:(Class)keyValueCodingClass isPrimitive:(BOOL)isPrimitive;
+
+/**
+ The name of the property. Equivalent to the value for `RKPropertyInspectionNameKey`.
+ */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ The class used for key-value coding access to the property. Equivalent to the value for `RKPropertyInspectionKeyValueCodingClassKey`.
+ */
+@property (nonatomic, strong, readonly) Class keyValueCodingClass;
+
+/**
+ A Boolean value that indicates if the property is a primitive (non-object) value. Equivalent to the value for `RKPropertyInspectionIsPrimitiveKey`.
+ */
+@property (nonatomic, assign, readonly, getter = isPrimitive) BOOL primitive;
+
+/**
+ Returns the detail of the inspection for one of the property inspection dictionary keys, or `nil` if the key is unknown.
+ */
+- (id)objectForKey:(NSString *)key;
+
+/**
+ Returns the detail of the inspection for one of the property inspection dictionary keys. Equivalent to `objectForKey:`.
+ */
+- (id)objectForKeyedSubscript:(NSString *)key;
+
+@end
+
+/**
+ The `RKPropertyAccessor` class provides direct access to a property of a class by invoking the implementations of its key-value coding compliant getter and setter methods, boxing and unboxing primitive values in the same way as key-value coding. Property accessors are obtained from an `RKPropertyInspector` and are only available for properties whose accessors can be called directly without changing the results of key-value coding.
+ */
+@interface RKPropertyAccessor : NSObject
+
+/**
+ The name of the property.
+ */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ The Objective-C type encoding of the property, such as `@` for an object or `i` for an `int`.
+ */
+@property (nonatomic, assign, readonly) char objCType;
+
+/**
+ A Boolean value that indicates if the property is a primitive (non-object) value.
+ */
+@property (nonatomic, assign, readonly, getter = isPrimitive) BOOL primitive;
+
+/**
+ Returns the value of the property for the given object, boxing primitive values into `NSNumber` objects.
+
+ @param object The object to retrieve the value of the property from.
+ @return The value of the property.
+ */
+- (id)valueForObject:(id)object;
+
+/**
+ Sets the value of the property on the given object, unboxing `NSNumber` values for primitive properties. Setting a `nil` value for a primitive property invokes `setNilValueForKey:` and values that cannot be unboxed are set with `setValue:forKey:`, matching the behavior of key-value coding.
+
+ @param value The new value of the property.
+ @param object The object to set the value of the property on.
+ */
+- (void)setValue:(id)value forObject:(id)object;
+
+@end
+
 /**
  The `RKPropertyInspector` class provides an interface for introspecting the properties and attributes of classes using the reflection capabilities of the Objective-C runtime. Once inspected, the properties inspection details are cached.
  */
@@ -64,7 +146,9 @@ extern NSString * const RKPropertyInspectionIsPrimitiveKey;
 ///------------------------------------------------------
 
 /**
- Returns a dictionary keyed by property name that includes the key-value coding class of the property and a Boolean indicating if the property is backed by a primitive (non-object) value. The dictionary for each property includes details about the key-value coding class representing the property and if the property is backed by a primitive type.
+ Returns a dictionary keyed by property name that includes the key-value coding class of the property and a Boolean indicating if the property is backed by a primitive (non-object) value. The value for each property is an `RKPropertyInspection` object describing the key-value coding class representing the property and if the property is backed by a primitive type.
+
+ Inspections are cached in an immutable dictionary that is replaced whenever a new class is inspected, so lookups for classes that have already been inspected do not require any locking.
  
  @param objectClass The class to inspect the properties of.
  @return A dictionary keyed by property name that includes details about all declared properties of the class.
@@ -81,6 +165,21 @@ extern NSString * const RKPropertyInspectionIsPrimitiveKey;
  */
 - (Class)classForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass isPrimitive:(BOOL *)isPrimitive;
 
+///------------------------------------
+/// @name Accessing Properties Directly
+///------------------------------------
+
+/**
+ Returns a property accessor for the property with the given name on a class. The getter and setter implementations and the type encoding of the property are resolved once and cached for each class and property name, and are resolved again if the implementations of the class change afterwards, as when key-value observing overrides the setter of a further key or a method is swizzled.
+
+ Accessors are resolved using the same method names that key-value coding searches for. `nil` is returned if the property is not backed by both a getter and a setter method, if its type cannot be boxed into an `NSNumber`, or if the class customizes key-value coding, such as subclasses of `NSManagedObject` and proxies. Callers should fall back to key-value coding in these cases.
+
+ @param propertyName The name of the property to access.
+ @param objectClass The class to access the property on. Pass the class returned by `object_getClass()` so that the accessors installed by key-value observing are honored.
+ @return A property accessor for the property, or `nil` if the property must be accessed with key-value coding.
+ */
+- (RKPropertyAccessor *)propertyAccessorForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass;
+
 @end
 
 ///----------------------------
@@ -31,13 +31,210 @@ NSString * const RKPropertyInspectionNameKey = @"name";
 NSString * const RKPropertyInspectionKeyValueCodingClassKey = @"keyValueCodingClass";
 NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
 
+// Skips the method type qualifiers (const, in, inout, out, bycopy, byref, oneway) preceding a type encoding
+static char RKObjCTypeFromMethodTypeEncoding(const char *typeEncoding)
+{
+    if (! typeEncoding) return '\0';
+    while (*typeEncoding && strchr("rnNoORV", *typeEncoding)) typeEncoding++;
+    return *typeEncoding;
+}
+
+static BOOL RKObjCTypeIsSupportedByPropertyAccessor(char objCType)
+{
+    return (objCType != '\0' && strchr("@cCsSiIlLqQfdB", objCType) != NULL);
+}
+
+// Returns the first instance method of the class implementing one of the given selectors, in order
+static Method RKInstanceMethodForSelectors(Class objectClass, SEL *selectors, NSUInteger count, SEL *foundSelector)
+{
+    for (NSUInteger i = 0; i < count; i++) {
+        Method method = class_getInstanceMethod(objectClass, selectors[i]);
+        if (method) {
+            *foundSelector = selectors[i];
+            return method;
+        }
+    }
+    return NULL;
+}
+
+// Returns YES if the class overrides any of the key-value coding entry points used during mapping, in which case its accessors cannot be called directly
+static BOOL RKClassCustomizesKeyValueCoding(Class objectClass)
+{
+    if (! class_respondsToSelector(objectClass, @selector(setValue:forKey:))) return YES;
+    Class managedObjectClass = NSClassFromString(@"NSManagedObject");
+    if (managedObjectClass && [objectClass isSubclassOfClass:managedObjectClass]) return YES;
+
+    SEL selectors[] = { @selector(valueForKey:), @selector(setValue:forKey:), @selector(valueForKeyPath:), @selector(setValue:forKeyPath:) };
+    for (NSUInteger i = 0; i < sizeof(selectors) / sizeof(SEL); i++) {
+        if (class_getMethodImplementation(objectClass, selectors[i]) != class_getMethodImplementation([NSObject class], selectors[i])) return YES;
+    }
+    return NO;
+}
+
+@interface RKPropertyAccessor ()
+@property (nonatomic, copy, readwrite) NSString *name;
+@property (nonatomic, assign, readwrite) char objCType;
+@property (nonatomic, assign) SEL getterSelector;
+@property (nonatomic, assign) IMP getterImplementation;
+@property (nonatomic, assign) SEL setterSelector;
+@property (nonatomic, assign) IMP setterImplementation;
+- (BOOL)invokesCurrentImplementationsOfClass:(Class)objectClass;
+@end
+
+@implementation RKPropertyAccessor
+
++ (id)propertyAccessorForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass
+{
+    if ([propertyName length] == 0 || RKClassCustomizesKeyValueCoding(objectClass)) return nil;
+
+    // Search for the getter and setter in the same order as key-value coding
+    NSString *capitalizedName = [[[propertyName substringToIndex:1] uppercaseString] stringByAppendingString:[propertyName substringFromIndex:1]];
+    SEL getters[] = { NSSelectorFromString([@"get" stringByAppendingString:capitalizedName]), NSSelectorFromString(propertyName),
+                      NSSelectorFromString([@"is" stringByAppendingString:capitalizedName]), NSSelectorFromString([@"_" stringByAppendingString:propertyName]) };
+    SEL setters[] = { NSSelectorFromString([NSString stringWithFormat:@"set%@:", capitalizedName]), NSSelectorFromString([NSString stringWithFormat:@"_set%@:", capitalizedName]) };
+    SEL getter = NULL, setter = NULL;
+    Method getterMethod = RKInstanceMethodForSelectors(objectClass, getters, sizeof(getters) / sizeof(SEL), &getter);
+    Method setterMethod = RKInstanceMethodForSelectors(objectClass, setters, sizeof(setters) / sizeof(SEL), &setter);
+    if (! getterMethod || ! setterMethod || method_getNumberOfArguments(getterMethod) != 2 || method_getNumberOfArguments(setterMethod) != 3) return nil;
+
+    char returnType[256], argumentType[256];
+    method_getReturnType(getterMethod, returnType, sizeof(returnType));
+    method_getArgumentType(setterMethod, 2, argumentType, sizeof(argumentType));
+    char objCType = RKObjCTypeFromMethodTypeEncoding(returnType);
+    if (objCType != RKObjCTypeFromMethodTypeEncoding(argumentType) || ! RKObjCTypeIsSupportedByPropertyAccessor(objCType)) return nil;
+
+    RKPropertyAccessor *propertyAccessor = [self new];
+    propertyAccessor.name = propertyName;
+    propertyAccessor.objCType = objCType;
+    propertyAccessor.getterSelector = getter;
+    propertyAccessor.getterImplementation = method_getImplementation(getterMethod);
+    propertyAccessor.setterSelector = setter;
+    propertyAccessor.setterImplementation = method_getImplementation(setterMethod);
+    return propertyAccessor;
+}
+
+- (BOOL)isPrimitive
+{
+    return self.objCType != '@';
+}
+
+// Key-value observing adds setter overrides to its subclass as further keys are observed, and methods may be swizzled, after an accessor has been resolved
+- (BOOL)invokesCurrentImplementationsOfClass:(Class)objectClass
+{
+    return class_getMethodImplementation(objectClass, self.setterSelector) == self.setterImplementation
+        && class_getMethodImplementation(objectClass, self.getterSelector) == self.getterImplementation;
+}
+
+- (id)valueForObject:(id)object
+{
+    IMP imp = self.getterImplementation;
+    SEL sel = self.getterSelector;
+    switch (self.objCType) {
+        case '@': return ((id (*)(id, SEL))imp)(object, sel);
+        case 'c': return [NSNumber numberWithChar:((char (*)(id, SEL))imp)(object, sel)];
+        case 'C': return [NSNumber numberWithUnsignedChar:((unsigned char (*)(id, SEL))imp)(object, sel)];
+        case 's': return [NSNumber numberWithShort:((short (*)(id, SEL))imp)(object, sel)];
+        case 'S': return [NSNumber numberWithUnsignedShort:((unsigned short (*)(id, SEL))imp)(object, sel)];
+        case 'i': return [NSNumber numberWithInt:((int (*)(id, SEL))imp)(object, sel)];
+        case 'I': return [NSNumber numberWithUnsignedInt:((unsigned int (*)(id, SEL))imp)(object, sel)];
+        case 'l': return [NSNumber numberWithLong:((long (*)(id, SEL))imp)(object, sel)];
+        case 'L': return [NSNumber numberWithUnsignedLong:((unsigned long (*)(id, SEL))imp)(object, sel)];
+        case 'q': return [NSNumber numberWithLongLong:((long long (*)(id, SEL))imp)(object, sel)];
+        case 'Q': return [NSNumber numberWithUnsignedLongLong:((unsigned long long (*)(id, SEL))imp)(object, sel)];
+        case 'f': return [NSNumber numberWithFloat:((float (*)(id, SEL))imp)(object, sel)];
+        case 'd': return [NSNumber numberWithDouble:((double (*)(id, SEL))imp)(object, sel)];
+        case 'B': return [NSNumber numberWithBool:((bool (*)(id, SEL))imp)(object, sel)];
+        default: return [object valueForKey:self.name];
+    }
+}
+
+- (void)setValue:(id)value forObject:(id)object
+{
+    IMP imp = self.setterImplementation;
+    SEL sel = self.setterSelector;
+    if (self.objCType == '@') {
+        ((void (*)(id, SEL, id))imp)(object, sel, value);
+        return;
+    }
+    if (value == nil) {
+        [object setNilValueForKey:self.name];
+        return;
+    }
+    if (! [value isKindOfClass:[NSNumber class]]) {
+        [object setValue:value forKey:self.name];
+        return;
+    }
+
+    switch (self.objCType) {
+        case 'c': ((void (*)(id, SEL, char))imp)(object, sel, [value charValue]); break;
+        case 'C': ((void (*)(id, SEL, unsigned char))imp)(object, sel, [value unsignedCharValue]); break;
+        case 's': ((void (*)(id, SEL, short))imp)(object, sel, [value shortValue]); break;
+        case 'S': ((void (*)(id, SEL, unsigned short))imp)(object, sel, [value unsignedShortValue]); break;
+        case 'i': ((void (*)(id, SEL, int))imp)(object, sel, [value intValue]); break;
+        case 'I': ((void (*)(id, SEL, unsigned int))imp)(object, sel, [value unsignedIntValue]); break;
+        case 'l': ((void (*)(id, SEL, long))imp)(object, sel, [value longValue]); break;
+        case 'L': ((void (*)(id, SEL, unsigned long))imp)(object, sel, [value unsignedLongValue]); break;
+        case 'q': ((void (*)(id, SEL, long long))imp)(object, sel, [value longLongValue]); break;
+        case 'Q': ((void (*)(id, SEL, unsigned long long))imp)(object, sel, [value unsignedLongLongValue]); break;
+        case 'f': ((void (*)(id, SEL, float))imp)(object, sel, [value floatValue]); break;
+        case 'd': ((void (*)(id, SEL, double))imp)(object, sel, [value doubleValue]); break;
+        case 'B': ((void (*)(id, SEL, bool))imp)(object, sel, [value boolValue]); break;
+        default: [object setValue:value forKey:self.name]; break;
+    }
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p name=%@ objCType=%c getter=%@ setter=%@>", NSStringFromClass([self class]), self,
+            self.name, self.objCType, NSStringFromSelector(self.getterSelector), NSStringFromSelector(self.setterSelector)];
+}
+
+@end
+
+@implementation RKPropertyInspection
+
+- (id)initWithName:(NSString *)name keyValueCodingClass:(Class)keyValueCodingClass isPrimitive:(BOOL)isPrimitive
+{
+    self = [super init];
+    if (self) {
+        _name = [name copy];
+        _keyValueCodingClass = keyValueCodingClass;
+        _primitive = isPrimitive;
+    }
+
+    return self;
+}
+
+- (id)objectForKey:(NSString *)key
+{
+    if ([key isEqualToString:RKPropertyInspectionKeyValueCodingClassKey]) return self.keyValueCodingClass;
+    if ([key isEqualToString:RKPropertyInspectionIsPrimitiveKey]) return @(self.isPrimitive);
+    if ([key isEqualToString:RKPropertyInspectionNameKey]) return self.name;
+    return nil;
+}
+
+- (id)objectForKeyedSubscript:(NSString *)key
+{
+    return [self objectForKey:key];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p name=%@ keyValueCodingClass=%@ isPrimitive=%@>", NSStringFromClass([self class]), self,
+            self.name, NSStringFromClass(self.keyValueCodingClass), self.isPrimitive ? @"YES" : @"NO"];
+}
+
+@end
+
 @interface RKPropertyInspector ()
 #if OS_OBJECT_USE_OBJC
 @property (nonatomic, strong) dispatch_queue_t queue;
 #else
 @property (nonatomic, assign) dispatch_queue_t queue;
 #endif
-@property (nonatomic, strong) NSMutableDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *accessorCache;
+- (void)cachePropertyInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key;
 @end
 
 @implementation RKPropertyInspector
@@ -57,9 +254,10 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
 {
     self = [super init];
     if (self) {
-        // NOTE: We use an `NSMutableDictionary` because it is *much* faster than `NSCache` on lookup
-        self.inspectionCache = [NSMutableDictionary dictionary];
-        self.queue = dispatch_queue_create("org.restkit.core-data.property-inspection-queue", DISPATCH_QUEUE_CONCURRENT);
+        // NOTE: The caches are immutable dictionaries that are copied and swapped on write so that lookups never wait on the queue
+        self.inspectionCache = [NSDictionary dictionary];
+        self.accessorCache = [NSDictionary dictionary];
+        self.queue = dispatch_queue_create("org.restkit.core-data.property-inspection-queue", DISPATCH_QUEUE_SERIAL);
     }
 
     return self;
@@ -73,15 +271,21 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
     _queue = NULL;
 }
 
-- (NSDictionary *)propertyInspectionForClass:(Class)objectClass
+- (void)cachePropertyInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key
 {
-    __block NSMutableDictionary *inspection;
-    dispatch_sync(self.queue, ^{
-        inspection = [self.inspectionCache objectForKey:objectClass];
+    dispatch_async(self.queue, ^{
+        NSMutableDictionary *inspectionCache = [self.inspectionCache mutableCopy];
+        [inspectionCache setObject:inspection forKey:key];
+        self.inspectionCache = inspectionCache;
     });
-    if (inspection) return inspection;
-    
-    inspection = [NSMutableDictionary dictionary];
+}
+
+- (NSDictionary *)propertyInspectionForClass:(Class)objectClass
+{
+    NSDictionary *cachedInspection = [self.inspectionCache objectForKey:objectClass];
+    if (cachedInspection) return cachedInspection;
+
+    NSMutableDictionary *inspection = [NSMutableDictionary dictionary];
 
     //include superclass properties
     Class currentClass = objectClass;
@@ -110,9 +314,7 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
                                 }
                             }
                             
-                            NSDictionary *propertyInspection = @{ RKPropertyInspectionNameKey: propNameString,
-                                                                  RKPropertyInspectionKeyValueCodingClassKey: aClass,
-                                                                  RKPropertyInspectionIsPrimitiveKey: @(isPrimitive) };
+                            RKPropertyInspection *propertyInspection = [[RKPropertyInspection alloc] initWithName:propNameString keyValueCodingClass:aClass isPrimitive:isPrimitive];
                             [inspection setObject:propertyInspection forKey:propNameString];
                         }
                     }
@@ -126,21 +328,39 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
         currentClass = (superclass == [NSObject class] || (nsManagedObject && superclass == nsManagedObject)) ? nil : superclass;
     }
 
-    dispatch_barrier_async(self.queue, ^{
-        [self.inspectionCache setObject:inspection forKey:(id<NSCopying>)objectClass];
-        RKLogDebug(@"Cached property inspection for Class '%@': %@", NSStringFromClass(objectClass), inspection);
-    });
-    return inspection;
+    cachedInspection = [inspection copy];
+    [self cachePropertyInspection:cachedInspection forKey:(id<NSCopying>)objectClass];
+    RKLogDebug(@"Cached property inspection for Class '%@': %@", NSStringFromClass(objectClass), cachedInspection);
+    return cachedInspection;
 }
 
 - (Class)classForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass isPrimitive:(BOOL *)isPrimitive
 {
     NSDictionary *classInspection = [self propertyInspectionForClass:objectClass];
-    NSDictionary *propertyInspection = [classInspection objectForKey:propertyName];
-    if (isPrimitive) *isPrimitive = [[propertyInspection objectForKey:RKPropertyInspectionIsPrimitiveKey] boolValue];
-    return [propertyInspection objectForKey:RKPropertyInspectionKeyValueCodingClassKey];
+    RKPropertyInspection *propertyInspection = [classInspection objectForKey:propertyName];
+    if (isPrimitive) *isPrimitive = propertyInspection.isPrimitive;
+    return propertyInspection.keyValueCodingClass;
 }
 
+- (RKPropertyAccessor *)propertyAccessorForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass
+{
+    if (! propertyName || ! objectClass) return nil;
+    id propertyAccessor = [[self.accessorCache objectForKey:objectClass] objectForKey:propertyName];
+    if (propertyAccessor == [NSNull null]) return nil;
+    if (propertyAccessor && [propertyAccessor invokesCurrentImplementationsOfClass:objectClass]) return propertyAccessor;
+
+    // Properties that must be accessed with key-value coding are cached as `NSNull` so they are only resolved once
+    propertyAccessor = [RKPropertyAccessor propertyAccessorForPropertyNamed:propertyName ofClass:objectClass] ?: [NSNull null];
+    dispatch_async(self.queue, ^{
+        NSMutableDictionary *classAccessors = [[self.accessorCache objectForKey:objectClass] mutableCopy] ?: [NSMutableDictionary dictionary];
+        [classAccessors setObject:propertyAccessor forKey:propertyName];
+        NSMutableDictionary *accessorCache = [self.accessorCache mutableCopy];
+        [accessorCache setObject:[classAccessors copy] forKey:(id<NSCopying>)objectClass];
+        self.accessorCache = accessorCache;
+        RKLogTrace(@"Cached property accessor for property '%@' of Class '%@': %@", propertyName, NSStringFromClass(objectClass), propertyAccessor);
+    });
+    return (propertyAccessor == [NSNull null]) ? nil : propertyAccessor;
+}
 @end
 
 
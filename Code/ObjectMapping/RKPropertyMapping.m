@@ -20,6 +20,7 @@
 
 #import "RKPropertyMapping.h"
 #import "RKObjectMapping.h"
+#import "RKObjectMappingPlan.h"
 
 /**
  For consistency with URI Templates (and most web templating languages in general) we are transitioning
@@ -69,6 +70,12 @@ static NSString *RKStringByReplacingUnderscoresWithBraces(NSString *string)
     return [NSString stringWithFormat:@"<%@: %p %@ => %@>", self.class, self, self.sourceKeyPath, self.destinationKeyPath];
 }
 
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    _valueTransformer = valueTransformer;
+    [self.objectMapping invalidateMappingPlan];
+}
+
 - (id<RKValueTransforming>)valueTransformer
 {
     return _valueTransformer ?: [self.objectMapping valueTransformer];
@@ -62,6 +62,7 @@ static NSUInteger RKNumberOfSlashesInString(NSString *string)
 {
     RKPathMatcher *copy = [[[self class] allocWithZone:zone] init];
     copy.socPattern = self.socPattern;
+    copy.patternString = self.patternString;
     copy.sourcePath = self.sourcePath;
     copy.rootPath = self.rootPath;
     copy.queryParameters = self.queryParameters;
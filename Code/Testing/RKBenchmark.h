@@ -108,4 +108,65 @@
  */
 - (void)log;
 
+///---------------------------
+/// @name Measuring Throughput
+///---------------------------
+
+/**
+ Runs a throughput benchmark by executing the block a fixed number of times, each inside its own autorelease pool, and recording the total elapsed time and the growth of the heap.
+
+ A fixed iteration count, rather than a time budget, keeps the amount of work performed identical across runs so that results can be compared between releases.
+
+ @param iterations The number of times to execute the block.
+ @param objectCount The number of objects processed by a single execution of the block, used to derive per-object figures.
+ @param executionBlock A block to execute as the body of the benchmark.
+ */
+- (void)runIterations:(NSUInteger)iterations objectCount:(NSUInteger)objectCount executionBlock:(void (^)(void))executionBlock;
+
+/**
+ The number of times the execution block was run by `runIterations:objectCount:executionBlock:`.
+ */
+@property (nonatomic, assign, readonly) NSUInteger iterations;
+
+/**
+ The number of objects processed by each iteration.
+ */
+@property (nonatomic, assign, readonly) NSUInteger objectCount;
+
+/**
+ The number of objects processed per second across all iterations.
+ */
+@property (nonatomic, assign, readonly) double operationsPerSecond;
+
+/**
+ The average net growth per object in the number of live heap blocks over an iteration, measured before its autorelease pool was drained, as reported by the `blocks_in_use` field of `malloc_zone_statistics`. This is not an allocation count: blocks allocated and freed within the iteration are not counted.
+ */
+@property (nonatomic, assign, readonly) double liveBlocksPerObject;
+
+/**
+ The average net growth per object in the number of live heap bytes, measured in the same way as `liveBlocksPerObject` from the `size_in_use` field of `malloc_zone_statistics`.
+ */
+@property (nonatomic, assign, readonly) double liveBytesPerObject;
+
+///----------------------------------
+/// @name Reporting Benchmark Results
+///----------------------------------
+
+/**
+ Returns a dictionary representation of the receiver suitable for serialization as JSON.
+
+ @return A dictionary containing the name, iteration count, object count, elapsed time, operations per second, live blocks per object and live bytes per object of the receiver.
+ */
+- (NSDictionary *)dictionaryRepresentation;
+
+/**
+ Writes the dictionary representations of the given benchmarks to a JSON file at the given path, replacing any existing file. Benchmarks are ordered by name so that the output of successive runs can be compared with a textual diff.
+
+ @param benchmarks An array of `RKBenchmark` objects to write.
+ @param path The path of the file to write.
+ @param error A pointer to an error object that is set if the file could not be written.
+ @return `YES` if the file was written successfully, else `NO`.
+ */
++ (BOOL)writeBenchmarks:(NSArray *)benchmarks toFileAtPath:(NSString *)path error:(NSError **)error;
+
 @end
@@ -7,6 +7,7 @@
 //  Copyleft 2009. Some rights reserved.
 //
 
+#import <malloc/malloc.h>
 #import "RKBenchmark.h"
 
 @interface RKBenchmark ()
@@ -14,6 +15,10 @@
 @property (nonatomic, assign, readwrite) CFAbsoluteTime endTime;
 @property (nonatomic, assign, readwrite) CFTimeInterval elapsedTime;
 @property (nonatomic, assign, getter = isStopped) BOOL stopped;
+@property (nonatomic, assign, readwrite) NSUInteger iterations;
+@property (nonatomic, assign, readwrite) NSUInteger objectCount;
+@property (nonatomic, assign, readwrite) double liveBlocksPerObject;
+@property (nonatomic, assign, readwrite) double liveBytesPerObject;
 @end
 
 @implementation RKBenchmark
@@ -126,4 +131,60 @@ static NSMutableDictionary *__sharedBenchmarks = nil;
     else         NSLog(@"Benchmark took %f seconds.", timeElapsed);
 }
 
+# pragma mark -
+# pragma mark Throughput methods
+
+- (void)runIterations:(NSUInteger)iterations objectCount:(NSUInteger)objectCount executionBlock:(void (^)(void))executionBlock
+{
+    NSParameterAssert(executionBlock);
+    self.iterations = iterations;
+    self.objectCount = objectCount;
+
+    double totalBlocks = 0, totalBytes = 0;
+    CFTimeInterval elapsedTime = 0;
+    for (NSUInteger i = 0; i < iterations; i++) {
+        @autoreleasepool {
+            malloc_statistics_t before, after;
+            malloc_zone_statistics(NULL, &before);
+            [self start];
+            executionBlock();
+            [self stop];
+            malloc_zone_statistics(NULL, &after);
+            elapsedTime += self.elapsedTime;
+            if (after.blocks_in_use > before.blocks_in_use) totalBlocks += after.blocks_in_use - before.blocks_in_use;
+            if (after.size_in_use > before.size_in_use) totalBytes += after.size_in_use - before.size_in_use;
+        }
+    }
+
+    self.elapsedTime = elapsedTime;
+    NSUInteger totalObjects = iterations * objectCount;
+    self.liveBlocksPerObject = totalObjects ? totalBlocks / totalObjects : 0;
+    self.liveBytesPerObject = totalObjects ? totalBytes / totalObjects : 0;
+}
+
+- (double)operationsPerSecond
+{
+    return (self.elapsedTime > 0) ? (self.iterations * self.objectCount) / self.elapsedTime : 0;
+}
+
+- (NSDictionary *)dictionaryRepresentation
+{
+    return @{ @"name": self.name ?: [NSNull null],
+              @"iterations": @(self.iterations),
+              @"objectCount": @(self.objectCount),
+              @"elapsedTime": @(self.elapsedTime),
+              @"operationsPerSecond": @(self.operationsPerSecond),
+              @"liveBlocksPerObject": @(self.liveBlocksPerObject),
+              @"liveBytesPerObject": @(self.liveBytesPerObject) };
+}
+
++ (BOOL)writeBenchmarks:(NSArray *)benchmarks toFileAtPath:(NSString *)path error:(NSError **)error
+{
+    // Order by name so that the output of successive runs lines up
+    NSArray *sortedBenchmarks = [benchmarks sortedArrayUsingDescriptors:@[ [NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES] ]];
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[sortedBenchmarks valueForKey:@"dictionaryRepresentation"] options:NSJSONWritingPrettyPrinted error:error];
+    if (! data) return NO;
+    return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
 @end
@@ -152,6 +152,30 @@
     assertThat(object.objectID, is(equalTo(human.objectID)));
 }
 
+- (void)testCompoundKeysWithSeparatorCharactersDoNotCollide
+{
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    self.cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity
+                                                       attributes:@[ @"name", @"nickName" ]
+                                             managedObjectContext:self.managedObjectContext];
+
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.name = @"a:b";
+    human1.nickName = @"c";
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.name = @"a";
+    human2.nickName = @"b:c";
+    [self.managedObjectContext save:nil];
+    [self.cache load:nil];
+    expect([self.cache isLoaded]).will.equal(YES);
+
+    expect([self.cache countOfAttributeValues]).to.equal(2);
+    NSSet *objects = [self.cache objectsWithAttributeValues:@{ @"name": @"a:b", @"nickName": @"c" } inContext:self.managedObjectContext];
+    expect([objects valueForKey:@"objectID"]).to.equal([NSSet setWithObject:human1.objectID]);
+    objects = [self.cache objectsWithAttributeValues:@{ @"name": @"a", @"nickName": @"b:c" } inContext:self.managedObjectContext];
+    expect([objects valueForKey:@"objectID"]).to.equal([NSSet setWithObject:human2.objectID]);
+}
+
 - (void)testRetrievalOfObjectsWithAttributeValue
 {
     RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
@@ -401,6 +425,187 @@
     [self.cache objectsWithAttributeValues:attributeValues inContext:self.managedObjectContext];
 }
 
+- (void)testUpdatingObjectsMovesOnlyThoseWhoseCacheKeyAttributesChanged
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache addObjects:[NSSet setWithObjects:human1, human2, nil] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+
+    human1.railsID = @3;
+    human2.name = @"Renamed";
+    done = NO;
+    [self.cache updateObjects:[NSSet setWithObjects:human1, human2, nil] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+
+    expect([self.cache objectIDsWithAttributeValues:@{ @"railsID": @1 }]).to.beEmpty();
+    expect([self.cache objectIDsWithAttributeValues:@{ @"railsID": @3 }]).to.equal([NSSet setWithObject:[human1 objectID]]);
+    expect([self.cache objectIDsWithAttributeValues:@{ @"railsID": @2 }]).to.equal([NSSet setWithObject:[human2 objectID]]);
+    expect([self.cache count]).to.equal(2);
+}
+
+- (void)testRetrievalOfObjectsMaterializesObjectIDsAndEvictsStaleObjectIDs
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    RKHuman *human3 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human3.railsID = @3;
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache addObjects:[NSSet setWithObjects:human1, human2, human3, nil] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    [self.managedObjectContext deleteObject:human3];
+    [self.managedObjectContext save:nil];
+
+    // None of the objects are registered with the child context, so they are fetched by ID
+    NSManagedObjectContext *childContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    childContext.parentContext = self.managedObjectContext;
+    NSSet *objects = [self.cache objectsWithAttributeValues:@{ @"railsID": @[ @1, @2, @3 ] } inContext:childContext];
+    expect([objects valueForKey:@"objectID"]).to.equal(([NSSet setWithObjects:human1.objectID, human2.objectID, nil]));
+    expect([[objects anyObject] managedObjectContext]).to.equal(childContext);
+    expect([self.cache count]).will.equal(2);
+}
+
+#pragma mark - Bounding Memory
+
+- (void)testBoundedCacheEvictsAttributeValuesThatWereNotRecentlyUsed
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    RKHuman *human3 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human3.railsID = @3;
+    [self.managedObjectContext save:nil];
+    self.cache.maximumObjectIDCount = 2;
+
+    __block BOOL done = NO;
+    [self.cache addObjects:[NSSet setWithObject:human1] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @1 } inContext:self.managedObjectContext]).to.equal(human1);
+    done = NO;
+    [self.cache addObjects:[NSSet setWithObject:human2] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+    done = NO;
+    [self.cache addObjects:[NSSet setWithObject:human3] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+
+    // The recent lookup of human1 spares it, so one of the humans that was never looked up is evicted
+    expect([self.cache count]).to.equal(2);
+    expect([self.cache containsObject:human1]).to.equal(YES);
+    expect([self.cache containsObject:human2] && [self.cache containsObject:human3]).to.equal(NO);
+    expect(self.cache.hitCount).to.equal(1);
+    expect(self.cache.evictionCount).to.equal(1);
+
+    // A miss is no longer conclusive and is reloaded with a fetch
+    RKHuman *evictedHuman = [self.cache containsObject:human2] ? human3 : human2;
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": evictedHuman.railsID } inContext:self.managedObjectContext]).to.equal(evictedHuman);
+    expect(self.cache.missCount).to.equal(1);
+    expect([self.cache containsObject:evictedHuman]).will.equal(YES);
+    expect([self.cache count]).will.equal(2);
+
+    [self.cache resetStatistics];
+    expect(self.cache.hitCount).to.equal(0);
+    expect(self.cache.missCount).to.equal(0);
+    expect(self.cache.evictionCount).to.equal(0);
+}
+
+- (void)testBoundedCacheLoadsNoMoreObjectsThanItCanRetain
+{
+    for (NSUInteger i = 1; i <= 3; i++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(i);
+    }
+    [self.managedObjectContext save:nil];
+    self.cache.maximumObjectIDCount = 2;
+
+    __block BOOL done = NO;
+    [self.cache load:^{ done = YES; }];
+    expect(done).will.equal(YES);
+    expect([self.cache count]).to.equal(2);
+    for (NSUInteger i = 1; i <= 3; i++) {
+        expect([self.cache objectWithAttributeValues:@{ @"railsID": @(i) } inContext:self.managedObjectContext]).notTo.beNil();
+    }
+}
+
+- (void)testLoadingFromIdentityIndexFaultsInObjectIDsOnLookup
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache load:^{ done = YES; }];
+    expect(done).will.equal(YES);
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"RKEntityByAttributeCacheTest.index"];
+    [[self.cache identityIndexDataWithMetadata:@{ @"generation": @"1" }] writeToFile:path atomically:YES];
+
+    RKEntityByAttributeCache *cache = [[RKEntityByAttributeCache alloc] initWithEntity:self.cache.entity attributes:@[ @"railsID" ] managedObjectContext:self.managedObjectContext];
+    expect([cache loadFromIdentityIndexAtPath:path metadata:@{ @"generation": @"2" }]).to.equal(NO);
+    expect([cache isLoaded]).to.equal(NO);
+    expect([cache loadFromIdentityIndexAtPath:path metadata:@{ @"generation": @"1" }]).to.equal(YES);
+    expect([cache isLoaded]).to.equal(YES);
+    expect([cache count]).to.equal(0);
+
+    expect([cache objectWithAttributeValues:@{ @"railsID": @1 } inContext:self.managedObjectContext]).to.equal(human1);
+    expect([cache count]).to.equal(1);
+    expect([cache objectWithAttributeValues:@{ @"railsID": @3 } inContext:self.managedObjectContext]).to.beNil();
+    expect(cache.missCount).to.equal(1);
+
+    // A change to a key that has not been faulted in merges with the associations in the index
+    RKHuman *human3 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human3.railsID = @2;
+    [self.managedObjectContext save:nil];
+    done = NO;
+    [cache addObjects:[NSSet setWithObject:human3] completion:^{ done = YES; }];
+    expect(done).will.equal(YES);
+    expect([cache objectsWithAttributeValues:@{ @"railsID": @2 } inContext:self.managedObjectContext]).to.equal([NSSet setWithObjects:human2, human3, nil]);
+
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testConcurrentLookupsObserveObjectsAddedFromAnotherThread
+{
+    NSMutableSet *humans = [NSMutableSet set];
+    for (NSUInteger i = 1; i <= 100; i++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(i);
+        [humans addObject:human];
+    }
+    [self.managedObjectContext save:nil];
+
+    __block BOOL done = NO;
+    [self.cache addObjects:humans completion:^{ done = YES; }];
+    __block NSUInteger lookupCount = 0;
+    dispatch_apply(4, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t worker) {
+        for (NSUInteger i = 1; i <= 100; i++) {
+            NSSet *objectIDs = [self.cache objectIDsWithAttributeValues:@{ @"railsID": @(i) }];
+            NSAssert([objectIDs count] <= 1, @"Expected at most one object ID for railsID %lu", (unsigned long)i);
+            @synchronized(self) { lookupCount++; }
+        }
+    });
+    expect(lookupCount).to.equal(400);
+    expect(done).will.equal(YES);
+
+    expect([self.cache count]).to.equal(100);
+    for (RKHuman *human in humans) {
+        expect([self.cache objectIDsWithAttributeValues:@{ @"railsID": human.railsID }]).to.equal([NSSet setWithObject:[human objectID]]);
+    }
+}
+
 #if TARGET_OS_IPHONE
 - (void)testCacheIsFlushedOnMemoryWarning
 {
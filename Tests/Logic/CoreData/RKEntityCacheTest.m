@@ -244,4 +244,23 @@
     assertThatBool([entityAttributeCache containsObject:human1], is(equalToBool(NO)));
 }
 
+- (void)testMaximumObjectIDCountIsDividedBetweenAttributeCaches
+{
+    _cache.maximumObjectIDCount = 100;
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]].maximumObjectIDCount).to.equal(100);
+
+    done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"name" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]].maximumObjectIDCount).to.equal(50);
+    expect([_cache attributeCacheForEntity:self.entity attributes:@[ @"name" ]].maximumObjectIDCount).to.equal(50);
+}
+
 @end
@@ -0,0 +1,69 @@
+//
+//  RKEntityIdentityIndexTest.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKEntityIdentityIndex.h"
+
+@interface RKEntityIdentityIndexTest : RKTestCase
+@end
+
+@implementation RKEntityIdentityIndexTest
+
+- (void)testKeyEncodingMatchesEqualValues
+{
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ @1 ])).to.equal(RKEntityIdentityIndexKeyDataForValues(@[ @1.0 ]));
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ @1 ])).to.equal(RKEntityIdentityIndexKeyDataForValues(@[ @YES ]));
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ @1 ])).notTo.equal(RKEntityIdentityIndexKeyDataForValues(@[ @"1" ]));
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ @1.5 ])).notTo.equal(RKEntityIdentityIndexKeyDataForValues(@[ @1 ]));
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ @"a", @"bc" ])).notTo.equal(RKEntityIdentityIndexKeyDataForValues(@[ @"ab", @"c" ]));
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ [NSNull null] ])).notTo.beNil();
+    expect(RKEntityIdentityIndexKeyDataForValues(@[ [NSObject new] ])).to.beNil();
+}
+
+- (void)testIndexRoundTripsObjectIDURIs
+{
+    NSMutableDictionary *objectIDURIStringsByKeyData = [NSMutableDictionary dictionary];
+    for (NSUInteger i = 0; i < 100; i++) {
+        NSString *objectIDURIString = [NSString stringWithFormat:@"x-coredata://4D2B61A6-D5B4-4B9B-9F55-B4F0D4D9B6C1/Human/p%lu", (unsigned long)i];
+        [objectIDURIStringsByKeyData setObject:@[ objectIDURIString ] forKey:RKEntityIdentityIndexKeyDataForValues(@[ @(i) ])];
+    }
+    [objectIDURIStringsByKeyData setObject:@[ @"x-coredata://4D2B61A6-D5B4-4B9B-9F55-B4F0D4D9B6C1/Human/p1000", @"x-coredata://4D2B61A6-D5B4-4B9B-9F55-B4F0D4D9B6C1/Child/p1" ] forKey:RKEntityIdentityIndexKeyDataForValues(@[ @"shared" ])];
+    NSData *data = [RKEntityIdentityIndex dataWithObjectIDURIStringsByKeyData:objectIDURIStringsByKeyData metadata:@{ @"generation": @"1" } complete:YES];
+
+    NSError *error = nil;
+    RKEntityIdentityIndex *identityIndex = [[RKEntityIdentityIndex alloc] initWithData:data error:&error];
+    expect(identityIndex).notTo.beNil();
+    expect(error).to.beNil();
+    expect(identityIndex.count).to.equal(101);
+    expect(identityIndex.isComplete).to.equal(YES);
+    expect(identityIndex.metadata).to.equal(@{ @"generation": @"1" });
+    expect([identityIndex objectIDURIStringsForKeyData:RKEntityIdentityIndexKeyDataForValues(@[ @42 ])]).to.equal(@[ @"x-coredata://4D2B61A6-D5B4-4B9B-9F55-B4F0D4D9B6C1/Human/p42" ]);
+    expect([NSSet setWithArray:[identityIndex objectIDURIStringsForKeyData:RKEntityIdentityIndexKeyDataForValues(@[ @"shared" ])]]).to.equal([NSSet setWithArray:[objectIDURIStringsByKeyData objectForKey:RKEntityIdentityIndexKeyDataForValues(@[ @"shared" ])]]);
+    expect([identityIndex objectIDURIStringsForKeyData:RKEntityIdentityIndexKeyDataForValues(@[ @100 ])]).to.beNil();
+
+    __block NSUInteger count = 0;
+    [identityIndex enumerateKeysAndObjectIDURIStringsUsingBlock:^(NSData *keyData, NSArray *objectIDURIStrings, BOOL *stop) {
+        expect(objectIDURIStrings).to.equal([objectIDURIStringsByKeyData objectForKey:keyData]);
+        count++;
+    }];
+    expect(count).to.equal(101);
+}
+
+- (void)testInitializationFailsForDataThatIsNotAnIndex
+{
+    NSError *error = nil;
+    RKEntityIdentityIndex *identityIndex = [[RKEntityIdentityIndex alloc] initWithData:[@"not an index" dataUsingEncoding:NSUTF8StringEncoding] error:&error];
+    expect(identityIndex).to.beNil();
+    expect([error code]).to.equal(NSFileReadCorruptFileError);
+
+    NSData *data = [RKEntityIdentityIndex dataWithObjectIDURIStringsByKeyData:@{ RKEntityIdentityIndexKeyDataForValues(@[ @1 ]): @[ @"x-coredata://store/Human/p1" ] } metadata:nil complete:YES];
+    identityIndex = [[RKEntityIdentityIndex alloc] initWithData:[data subdataWithRange:NSMakeRange(0, [data length] / 2)] error:&error];
+    expect(identityIndex).to.beNil();
+}
+
+@end
@@ -10,6 +10,10 @@
 #import "RKCat.h"
 #import "RKEvent.h"
 
+@interface RKFetchRequestManagedObjectCache (Specs)
+- (id)fetchRequestTemplateForEntity:(NSEntityDescription *)entity attributeValues:(NSDictionary *)attributeValues;
+@end
+
 @interface RKFetchRequestMappingCacheTest : RKTestCase
 
 @end
@@ -106,4 +110,94 @@
     expect(managedObjects).to.equal(events);
 }
 
+- (void)testRetrievingObjectsForACollectionOfAttributeValues
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *cache = [RKFetchRequestManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    reginald.name = @"Reginald";
+    reginald.railsID = @123;
+    RKCat *asia = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    asia.name = @"Asia";
+    asia.railsID = @456;
+    [managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    NSArray *attributeValuesCollection = @[ @{ @"railsID": @123 }, @{ @"railsID": @456 }, @{ @"railsID": @789 }, @{ @"railsID": @123, @"name": @"Reginald" }, @{ @"railsID": @456, @"name": @"Reginald" } ];
+    NSDictionary *managedObjects = [cache managedObjectsWithEntity:entity
+                                         attributeValuesCollection:attributeValuesCollection
+                                            inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    expect(managedObjects).to.haveCountOf(5);
+    expect([managedObjects objectForKey:@{ @"railsID": @123 }]).to.equal([NSSet setWithObject:reginald]);
+    expect([managedObjects objectForKey:@{ @"railsID": @456 }]).to.equal([NSSet setWithObject:asia]);
+    expect([managedObjects objectForKey:@{ @"railsID": @789 }]).to.equal([NSSet set]);
+    expect([managedObjects objectForKey:@{ @"railsID": @123, @"name": @"Reginald" }]).to.equal([NSSet setWithObject:reginald]);
+    expect([managedObjects objectForKey:@{ @"railsID": @456, @"name": @"Reginald" }]).to.equal([NSSet set]);
+}
+
+- (void)testFetchCountIncludesEverySingularAndBatchedFetch
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *cache = [RKFetchRequestManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    reginald.name = @"Reginald";
+    reginald.railsID = @123;
+    [managedObjectStore.persistentStoreManagedObjectContext save:nil];
+    expect(cache.fetchCount).to.equal(0);
+
+    for (NSUInteger i = 0; i < 3; i++) {
+        NSSet *managedObjects = [cache managedObjectsWithEntity:entity
+                                                attributeValues:@{ @"railsID": @123, @"name": [NSNull null] }
+                                         inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+        expect(managedObjects).to.equal([NSSet set]);
+        managedObjects = [cache managedObjectsWithEntity:entity
+                                         attributeValues:@{ @"railsID": @123, @"name": @"Reginald" }
+                                  inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+        expect(managedObjects).to.equal([NSSet setWithObject:reginald]);
+    }
+    expect(cache.fetchCount).to.equal(6);
+
+    [cache managedObjectsWithEntity:entity
+          attributeValuesCollection:@[ @{ @"railsID": @123 }, @{ @"railsID": @456 } ]
+             inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    expect(cache.fetchCount).to.equal(7);
+}
+
+- (void)testFetchLimitIsOnlyAppliedWhenTheAttributesCoverAUniquenessConstraint
+{
+    NSEntityDescription *entity = [NSEntityDescription new];
+    if (! [entity respondsToSelector:NSSelectorFromString(@"uniquenessConstraints")]) return;
+    entity.name = @"UniqueCat";
+    NSAttributeDescription *railsID = [NSAttributeDescription new];
+    railsID.name = @"railsID";
+    railsID.attributeType = NSInteger32AttributeType;
+    NSAttributeDescription *name = [NSAttributeDescription new];
+    name.name = @"name";
+    name.attributeType = NSStringAttributeType;
+    entity.properties = @[ railsID, name ];
+    [entity setValue:@[ @[ @"railsID" ] ] forKey:@"uniquenessConstraints"];
+
+    RKFetchRequestManagedObjectCache *cache = [RKFetchRequestManagedObjectCache new];
+    id uniqueTemplate = [cache fetchRequestTemplateForEntity:entity attributeValues:@{ @"railsID": @123 }];
+    expect([uniqueTemplate valueForKeyPath:@"fetchRequest.fetchLimit"]).to.equal(1);
+    id coveringTemplate = [cache fetchRequestTemplateForEntity:entity attributeValues:@{ @"railsID": @123, @"name": @"Reginald" }];
+    expect([coveringTemplate valueForKeyPath:@"fetchRequest.fetchLimit"]).to.equal(1);
+    id nonUniqueTemplate = [cache fetchRequestTemplateForEntity:entity attributeValues:@{ @"name": @"Reginald" }];
+    expect([nonUniqueTemplate valueForKeyPath:@"fetchRequest.fetchLimit"]).to.equal(0);
+    id collectionTemplate = [cache fetchRequestTemplateForEntity:entity attributeValues:@{ @"railsID": @[ @123, @456 ] }];
+    expect([collectionTemplate valueForKeyPath:@"fetchRequest.fetchLimit"]).to.equal(0);
+}
+
+- (void)testFetchLimitIsNotAppliedToEntitiesWithoutUniquenessConstraints
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    RKFetchRequestManagedObjectCache *cache = [RKFetchRequestManagedObjectCache new];
+    id template = [cache fetchRequestTemplateForEntity:entity attributeValues:@{ @"railsID": @123 }];
+    expect([template valueForKeyPath:@"fetchRequest.fetchLimit"]).to.equal(0);
+}
+
 @end
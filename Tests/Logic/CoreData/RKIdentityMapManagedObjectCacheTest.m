@@ -0,0 +1,117 @@
+//
+//  RKIdentityMapManagedObjectCacheTest.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKIdentityMapManagedObjectCache.h"
+#import "RKCat.h"
+
+@interface RKIdentityMapManagedObjectCacheTest : RKTestCase
+
+@end
+
+@implementation RKIdentityMapManagedObjectCacheTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (void)testRepeatedLookupsAreSatisfiedByTheIdentityMap
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKIdentityMapManagedObjectCache *cache = [RKIdentityMapManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    reginald.railsID = @123;
+    [managedObjectContext save:nil];
+
+    for (NSUInteger i = 0; i < 3; i++) {
+        NSSet *managedObjects = [cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @123 } inManagedObjectContext:managedObjectContext];
+        expect(managedObjects).to.equal([NSSet setWithObject:reginald]);
+    }
+    expect(cache.fetchRequestCache.fetchCount).to.equal(1);
+}
+
+- (void)testMissesAreRememberedUntilTheObjectIsCreated
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKIdentityMapManagedObjectCache *cache = [RKIdentityMapManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @456 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet set]);
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @456 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet set]);
+    expect(cache.fetchRequestCache.fetchCount).to.equal(1);
+
+    RKCat *asia = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    asia.railsID = @456;
+    [cache didCreateObject:asia];
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @456 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet setWithObject:asia]);
+
+    [managedObjectContext deleteObject:asia];
+    [cache didDeleteObject:asia];
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @456 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet set]);
+    expect(cache.fetchRequestCache.fetchCount).to.equal(1);
+}
+
+- (void)testCollectionLookupsOnlyFetchTheMisses
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKIdentityMapManagedObjectCache *cache = [RKIdentityMapManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    reginald.railsID = @123;
+    RKCat *asia = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    asia.railsID = @456;
+    [managedObjectContext save:nil];
+
+    [cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @123 } inManagedObjectContext:managedObjectContext];
+    expect(cache.fetchRequestCache.fetchCount).to.equal(1);
+
+    NSDictionary *managedObjects = [cache managedObjectsWithEntity:entity
+                                         attributeValuesCollection:@[ @{ @"railsID": @123 }, @{ @"railsID": @456 }, @{ @"railsID": @789 } ]
+                                            inManagedObjectContext:managedObjectContext];
+    expect([managedObjects objectForKey:@{ @"railsID": @123 }]).to.equal([NSSet setWithObject:reginald]);
+    expect([managedObjects objectForKey:@{ @"railsID": @456 }]).to.equal([NSSet setWithObject:asia]);
+    expect([managedObjects objectForKey:@{ @"railsID": @789 }]).to.equal([NSSet set]);
+    expect(cache.fetchRequestCache.fetchCount).to.equal(2);
+
+    [cache managedObjectsWithEntity:entity
+          attributeValuesCollection:@[ @{ @"railsID": @123 }, @{ @"railsID": @456 }, @{ @"railsID": @789 } ]
+             inManagedObjectContext:managedObjectContext];
+    expect(cache.fetchRequestCache.fetchCount).to.equal(2);
+}
+
+- (void)testSavingAContextDiscardsTheIdentityMap
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKIdentityMapManagedObjectCache *cache = [RKIdentityMapManagedObjectCache new];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @123 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet set]);
+
+    // Insert the object without informing the cache, as another context would
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectContext];
+    reginald.railsID = @123;
+    [managedObjectContext save:nil];
+
+    expect([cache managedObjectsWithEntity:entity attributeValues:@{ @"railsID": @123 } inManagedObjectContext:managedObjectContext]).to.equal([NSSet setWithObject:reginald]);
+    expect(cache.fetchRequestCache.fetchCount).to.equal(2);
+}
+
+@end
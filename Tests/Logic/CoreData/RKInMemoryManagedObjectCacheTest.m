@@ -10,10 +10,7 @@
 #import "RKInMemoryManagedObjectCache.h"
 #import "RKHuman.h"
 #import "RKEntityCache.h"
-
-@interface RKInMemoryManagedObjectCache ()
-@property (nonatomic, readonly) RKEntityCache *entityCache;
-@end
+#import "RKEntityByAttributeCache.h"
 
 @interface RKInMemoryManagedObjectCacheTest : RKTestCase
 @property (nonatomic, strong) RKManagedObjectStore *managedObjectStore;
@@ -75,7 +72,7 @@
     expect([self.managedObjectCache.entityCache containsObject:cloud]).will.equal(NO);
 }
 
-- (void)testManagedObjectContextProcessPendingChangesAddsUpdatedObjectsToCache
+- (void)testManagedObjectContextProcessPendingChangesIgnoresUpdatesToUnidentifyingAttributes
 {
     RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
     human1.railsID = [NSNumber numberWithInteger:12345];
@@ -88,9 +85,23 @@
     }];
     expect(done).will.equal(YES);
     human1.name = @"Modified Name";
-    expect([self.managedObjectCache.entityCache containsObject:human1]).will.equal(NO);
+    [self waitForPendingChangesToProcess];
+    expect([self.managedObjectCache.entityCache containsObject:human1]).to.equal(NO);
+}
+
+- (void)testManagedObjectContextProcessPendingChangesMovesObjectsWhoseIdentificationAttributesChanged
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    human1.railsID = [NSNumber numberWithInteger:12345];
     [self waitForPendingChangesToProcess];
     expect([self.managedObjectCache.entityCache containsObject:human1]).will.equal(YES);
+
+    human1.railsID = [NSNumber numberWithInteger:54321];
+    [self waitForPendingChangesToProcess];
+    RKEntityByAttributeCache *attributeCache = [self.managedObjectCache.entityCache attributeCacheForEntity:self.humanEntity attributes:@[ @"railsID" ]];
+    expect([attributeCache objectIDsWithAttributeValues:@{ @"railsID": @12345 }]).to.beEmpty();
+    expect([attributeCache objectIDsWithAttributeValues:@{ @"railsID": @54321 }]).to.equal([NSSet setWithObject:[human1 objectID]]);
+    expect([attributeCache count]).to.equal(1);
 }
 
 - (void)testManagedObjectContextProcessPendingChangesRemovesExistingObjectsFromCache
@@ -131,4 +142,37 @@
     }];
 }
 
+- (void)testLookupIsSatisfiedByFetchRequestUntilCacheHasLoaded
+{
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    human.name = @"Blake";
+    [self.managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    NSSet *objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"name": @"Blake" } inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    expect(objects).to.equal([NSSet setWithObject:human]);
+    expect([managedObjectCache.entityCache isEntity:self.humanEntity cachedByAttributes:@[ @"name" ]]).will.beTruthy();
+    objects = [managedObjectCache managedObjectsWithEntity:self.humanEntity attributeValues:@{ @"name": @"Blake" } inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    expect(objects).to.equal([NSSet setWithObject:human]);
+}
+
+- (void)testLoadingEntityCoalescesConcurrentRequests
+{
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    human.name = @"Blake";
+    human.nickName = @"Blakey";
+    [self.managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    __block NSUInteger completionCount = 0;
+    [self.managedObjectCache loadEntity:self.humanEntity byAttributes:@[ @"name", @"nickName" ] completion:^{
+        completionCount++;
+    }];
+    [self.managedObjectCache loadEntity:self.humanEntity byAttributes:@[ @"nickName", @"name" ] completion:^{
+        completionCount++;
+    }];
+    expect(completionCount).will.equal(2);
+    expect([[self.managedObjectCache.entityCache attributeCachesForEntity:self.humanEntity] count]).to.equal(2);
+    expect([self.managedObjectCache.entityCache containsObject:human]).to.beTruthy();
+}
+
 @end
@@ -0,0 +1,313 @@
+//
+//  RKManagedObjectImporterTest.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+
+@interface RKManagedObjectImporterTest : RKTestCase <RKManagedObjectImporterDelegate>
+@property (nonatomic, strong) NSString *directoryPath;
+@property (nonatomic, strong) RKManagedObjectImporter *importer;
+@property (nonatomic, strong) NSMutableArray *progressReports;
+@end
+
+@implementation RKManagedObjectImporterTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+
+    self.directoryPath = [NSTemporaryDirectory() stringByAppendingPathComponent:@"RKManagedObjectImporterTest"];
+    [[NSFileManager defaultManager] removeItemAtPath:self.directoryPath error:nil];
+    [[NSFileManager defaultManager] createDirectoryAtPath:self.directoryPath withIntermediateDirectories:YES attributes:nil error:nil];
+
+    NSURL *modelURL = [[RKTestFixture fixtureBundle] URLForResource:@"Data Model" withExtension:@"mom"];
+    NSManagedObjectModel *managedObjectModel = [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+    self.importer = [[RKManagedObjectImporter alloc] initWithManagedObjectModel:managedObjectModel storePath:[self.directoryPath stringByAppendingPathComponent:@"Import.sqlite"]];
+    self.importer.delegate = self;
+    self.progressReports = [NSMutableArray array];
+}
+
+- (void)tearDown
+{
+    self.importer = nil;
+    [[NSFileManager defaultManager] removeItemAtPath:self.directoryPath error:nil];
+    [RKTestFactory tearDown];
+}
+
+#pragma mark - Helpers
+
+- (NSString *)writeFileAtPath:(NSString *)relativePath withContents:(NSString *)contents
+{
+    NSString *path = [self.directoryPath stringByAppendingPathComponent:relativePath];
+    [[NSFileManager defaultManager] createDirectoryAtPath:[path stringByDeletingLastPathComponent] withIntermediateDirectories:YES attributes:nil error:nil];
+    [contents writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:nil];
+    return path;
+}
+
+- (RKEntityMapping *)humanMapping
+{
+    RKEntityMapping *humanMapping = [[RKEntityMapping alloc] initWithEntity:[[self.importer.managedObjectModel entitiesByName] objectForKey:@"Human"]];
+    [humanMapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name" }];
+    humanMapping.identificationAttributes = @[ @"railsID" ];
+    return humanMapping;
+}
+
+- (RKEntityMapping *)catMapping
+{
+    RKEntityMapping *catMapping = [[RKEntityMapping alloc] initWithEntity:[[self.importer.managedObjectModel entitiesByName] objectForKey:@"Cat"]];
+    [catMapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name", @"human_id": @"humanId" }];
+    catMapping.identificationAttributes = @[ @"railsID" ];
+    [catMapping addConnectionForRelationship:@"human" connectedBy:@{ @"humanId": @"railsID" }];
+    return catMapping;
+}
+
+// Returns the values at the key path of the imported objects of the entity, ordered by their `railsID`
+- (NSArray *)importedValuesForKeyPath:(NSString *)keyPath ofEntityForName:(NSString *)entityName
+{
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:entityName];
+    fetchRequest.sortDescriptors = @[ [NSSortDescriptor sortDescriptorWithKey:@"railsID" ascending:YES] ];
+    __block NSArray *values = nil;
+    [self.importer.managedObjectContext performBlockAndWait:^{
+        NSMutableArray *mutableValues = [NSMutableArray array];
+        for (NSManagedObject *managedObject in [self.importer.managedObjectContext executeFetchRequest:fetchRequest error:nil]) {
+            [mutableValues addObject:[managedObject valueForKeyPath:keyPath] ?: [NSNull null]];
+        }
+        values = mutableValues;
+    }];
+    return values;
+}
+
+// Counts the objects of the entity that have been saved to the persistent store
+- (NSUInteger)persistedObjectCountOfEntityForName:(NSString *)entityName
+{
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    __block NSUInteger count = 0;
+    [managedObjectContext performBlockAndWait:^{
+        managedObjectContext.persistentStoreCoordinator = self.importer.persistentStoreCoordinator;
+        count = [managedObjectContext countForFetchRequest:[NSFetchRequest fetchRequestWithEntityName:entityName] error:nil];
+    }];
+    return count;
+}
+
+- (void)managedObjectImporter:(RKManagedObjectImporter *)importer didImportObjectCount:(NSUInteger)objectCount fromFileAtPath:(NSString *)path fractionCompleted:(double)fractionCompleted objectsPerSecond:(double)objectsPerSecond
+{
+    [self.progressReports addObject:@{ @"objectCount": @(objectCount), @"path": path, @"fractionCompleted": @(fractionCompleted) }];
+}
+
+#pragma mark - Streaming JSON Arrays
+
+- (void)testStreamingARootArray
+{
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:@"[{\"id\": 1, \"name\": \"Blake\"}, {\"id\": 2, \"name\": \"Sarah\"}, {\"id\": 3, \"name\": \"Colin\"}]"];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(3);
+    expect(error).to.beNil();
+    expect(self.progressReports).to.haveCountOf(1);
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal((@[ @"Blake", @"Sarah", @"Colin" ]));
+}
+
+- (void)testStreamingAnArrayAtAKeyPath
+{
+    NSString *contents = @"{\"meta\": {\"humans\": [{\"id\": 9, \"name\": \"Decoy\"}]}, \"data\": {\"count\": 2, \"humans\": [{\"id\": 1, \"name\": \"Blake\"}, {\"id\": 2, \"name\": \"Sarah\"}]}}";
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:contents];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:@"data.humans" error:&error];
+    expect(count).to.equal(2);
+    expect(error).to.beNil();
+    expect(self.progressReports).to.haveCountOf(1);
+    expect([self importedValuesForKeyPath:@"railsID" ofEntityForName:@"Human"]).to.equal((@[ @1, @2 ]));
+}
+
+- (void)testStreamingWithEscapedQuotesInKeysAndValues
+{
+    NSString *contents = @"{\"the \\\"other\\\" humans\": [], \"the \\\"humans\\\"\": [{\"id\": 1, \"name\": \"Blake \\\"]}\\\" Watters\"}, {\"id\": 2, \"name\": \"\\\\\"}]}";
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:contents];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:@"the \"humans\"" error:&error];
+    expect(count).to.equal(2);
+    expect(error).to.beNil();
+    expect(self.progressReports).to.haveCountOf(1);
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal((@[ @"Blake \"]}\" Watters", @"\\" ]));
+}
+
+- (void)testStreamingAnElementThatSpansTheReadBuffer
+{
+    // Longer than the read buffer of the importer, so that the element is read across several buffers
+    NSString *longName = [@"" stringByPaddingToLength:200000 withString:@"Blake" startingAtIndex:0];
+    NSString *contents = [NSString stringWithFormat:@"[{\"id\": 1, \"name\": \"Sarah\"}, {\"id\": 2, \"name\": \"%@\"}, {\"id\": 3, \"name\": \"Colin\"}]", longName];
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:contents];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(3);
+    expect(error).to.beNil();
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal((@[ @"Sarah", longName, @"Colin" ]));
+}
+
+- (void)testStreamingAnArrayOfScalarValues
+{
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:@"{\"human_ids\": [1, 2, 3]}"];
+    RKEntityMapping *humanMapping = [[RKEntityMapping alloc] initWithEntity:[[self.importer.managedObjectModel entitiesByName] objectForKey:@"Human"]];
+    humanMapping.identificationAttributes = @[ @"railsID" ];
+    [humanMapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:nil toKeyPath:@"railsID"]];
+    self.importer.batchSize = 2;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:humanMapping keyPath:@"human_ids" error:&error];
+    expect(count).to.equal(3);
+    expect(error).to.beNil();
+    expect([self importedValuesForKeyPath:@"railsID" ofEntityForName:@"Human"]).to.equal((@[ @1, @2, @3 ]));
+}
+
+- (void)testContentThatIsNotAnArrayIsImportedWithoutStreaming
+{
+    NSString *path = [self writeFileAtPath:@"human.json" withContents:@"{\"human\": {\"id\": 1, \"name\": \"Blake\"}}"];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:@"human" error:&error];
+    expect(count).to.equal(1);
+    expect(error).to.beNil();
+    expect(self.progressReports).to.haveCountOf(0);
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal(@[ @"Blake" ]);
+}
+
+- (void)testStreamingATruncatedFileReturnsAnError
+{
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:@"[{\"id\": 1, \"name\": \"Blake\"}, {\"id\": 2, \"name\": \"Sa"];
+    self.importer.batchSize = 10;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(NSNotFound);
+    expect(error).notTo.beNil();
+}
+
+- (void)testStreamingSavesEachBatchAndReportsProgress
+{
+    NSString *path = [self writeFileAtPath:@"humans.json" withContents:@"[{\"id\": 1}, {\"id\": 2}, {\"id\": 3}, {\"id\": 4}, {\"id\": 5}]"];
+    self.importer.batchSize = 2;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:path withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(5);
+    expect(error).to.beNil();
+
+    // Every batch has been saved without finishing the import
+    expect([self persistedObjectCountOfEntityForName:@"Human"]).to.equal(5);
+    expect([self.progressReports valueForKey:@"objectCount"]).to.equal((@[ @2, @4, @5 ]));
+    expect([self.progressReports valueForKey:@"path"]).to.equal((@[ path, path, path ]));
+    double previousFractionCompleted = 0;
+    for (NSDictionary *progressReport in self.progressReports) {
+        double fractionCompleted = [[progressReport objectForKey:@"fractionCompleted"] doubleValue];
+        expect(fractionCompleted).to.beGreaterThan(0);
+        expect(fractionCompleted).notTo.beLessThan(previousFractionCompleted);
+        previousFractionCompleted = fractionCompleted;
+    }
+    expect(previousFractionCompleted).to.equal(1);
+}
+
+- (void)testStreamingConnectsTheDeferredRelationshipsOfFilesImportedEarlier
+{
+    NSString *humanPath = [self writeFileAtPath:@"human.json" withContents:@"{\"human\": {\"id\": 1, \"name\": \"Blake\"}}"];
+    NSString *catPath = [self writeFileAtPath:@"cat.json" withContents:@"{\"cat\": {\"id\": 10, \"name\": \"Asia\", \"human_id\": 1}}"];
+    NSString *humansPath = [self writeFileAtPath:@"humans.json" withContents:@"[{\"id\": 2}, {\"id\": 3}]"];
+    self.importer.batchSize = 1;
+    NSError *error = nil;
+    expect([self.importer importObjectsFromItemAtPath:humanPath withMapping:[self humanMapping] keyPath:@"human" error:&error]).to.equal(1);
+    expect([self.importer importObjectsFromItemAtPath:catPath withMapping:[self catMapping] keyPath:@"cat" error:&error]).to.equal(1);
+    expect([self.importer importObjectsFromItemAtPath:humansPath withMapping:[self humanMapping] keyPath:nil error:&error]).to.equal(2);
+    BOOL success = [self.importer finishImporting:&error];
+    expect(success).to.equal(YES);
+    expect(error).to.beNil();
+
+    expect([self importedValuesForKeyPath:@"human.railsID" ofEntityForName:@"Cat"]).to.equal(@[ @1 ]);
+    expect([self importedValuesForKeyPath:@"cats.@count" ofEntityForName:@"Human"]).to.equal((@[ @1, @0, @0 ]));
+}
+
+#pragma mark - Importing Directories
+
+- (void)testImportingADirectoryImportsEveryFileInIt
+{
+    [self writeFileAtPath:@"Humans/1.json" withContents:@"[{\"id\": 1, \"name\": \"Blake\"}, {\"id\": 2, \"name\": \"Sarah\"}]"];
+    [self writeFileAtPath:@"Humans/2.json" withContents:@"[{\"id\": 3, \"name\": \"Colin\"}]"];
+    expect(self.importer.maxConcurrentFileImportCount).to.equal(1);
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Humans"] withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(3);
+    expect(error).to.beNil();
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal((@[ @"Blake", @"Sarah", @"Colin" ]));
+}
+
+- (void)testImportingADirectorySkipsHiddenEntriesAndSubdirectories
+{
+    [self writeFileAtPath:@"Humans/1.json" withContents:@"[{\"id\": 1, \"name\": \"Blake\"}]"];
+    [self writeFileAtPath:@"Humans/.hidden.json" withContents:@"[{\"id\": 2, \"name\": \"Hidden\"}]"];
+    [self writeFileAtPath:@"Humans/Nested/3.json" withContents:@"[{\"id\": 3, \"name\": \"Nested\"}]"];
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Humans"] withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(1);
+    expect(error).to.beNil();
+    expect([self importedValuesForKeyPath:@"name" ofEntityForName:@"Human"]).to.equal(@[ @"Blake" ]);
+}
+
+- (void)testImportingADirectoryConcurrently
+{
+    for (NSUInteger fileIndex = 0; fileIndex < 8; fileIndex++) {
+        NSString *contents = [NSString stringWithFormat:@"[{\"id\": %lu}, {\"id\": %lu}]", (unsigned long)fileIndex * 2 + 1, (unsigned long)fileIndex * 2 + 2];
+        [self writeFileAtPath:[NSString stringWithFormat:@"Humans/%lu.json", (unsigned long)fileIndex] withContents:contents];
+    }
+    self.importer.maxConcurrentFileImportCount = 4;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Humans"] withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(16);
+    expect(error).to.beNil();
+    BOOL success = [self.importer finishImporting:&error];
+    expect(success).to.equal(YES);
+
+    NSMutableArray *expectedIDs = [NSMutableArray array];
+    for (NSUInteger railsID = 1; railsID <= 16; railsID++) [expectedIDs addObject:@(railsID)];
+    expect([self importedValuesForKeyPath:@"railsID" ofEntityForName:@"Human"]).to.equal(expectedIDs);
+    expect([self persistedObjectCountOfEntityForName:@"Human"]).to.equal(16);
+}
+
+- (void)testImportingADirectoryConcurrentlyStopsAfterTheFirstFailure
+{
+    [self writeFileAtPath:@"Humans/00.json" withContents:@"[{\"id\": 1,"];
+    for (NSUInteger fileIndex = 1; fileIndex <= 40; fileIndex++) {
+        [self writeFileAtPath:[NSString stringWithFormat:@"Humans/%02lu.json", (unsigned long)fileIndex] withContents:[NSString stringWithFormat:@"[{\"id\": %lu}]", (unsigned long)fileIndex + 1]];
+    }
+    self.importer.maxConcurrentFileImportCount = 2;
+    NSError *error = nil;
+    NSUInteger count = [self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Humans"] withMapping:[self humanMapping] keyPath:nil error:&error];
+    expect(count).to.equal(NSNotFound);
+    expect(error).notTo.beNil();
+
+    // The files queued behind the failed file are cancelled rather than imported
+    expect([[self importedValuesForKeyPath:@"railsID" ofEntityForName:@"Human"] count]).to.beLessThan(40);
+}
+
+- (void)testImportingDirectoriesConcurrentlyConnectsRelationshipsAcrossFiles
+{
+    [self writeFileAtPath:@"Humans/1.json" withContents:@"[{\"id\": 1, \"name\": \"Blake\"}]"];
+    [self writeFileAtPath:@"Humans/2.json" withContents:@"[{\"id\": 2, \"name\": \"Sarah\"}]"];
+    [self writeFileAtPath:@"Cats/1.json" withContents:@"[{\"id\": 10, \"name\": \"Asia\", \"human_id\": 2}, {\"id\": 11, \"name\": \"Lola\", \"human_id\": 1}]"];
+    [self writeFileAtPath:@"Cats/2.json" withContents:@"[{\"id\": 12, \"name\": \"Reginald\", \"human_id\": 2}]"];
+    self.importer.maxConcurrentFileImportCount = 2;
+    NSError *error = nil;
+    expect([self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Humans"] withMapping:[self humanMapping] keyPath:nil error:&error]).to.equal(2);
+    expect([self.importer importObjectsFromItemAtPath:[self.directoryPath stringByAppendingPathComponent:@"Cats"] withMapping:[self catMapping] keyPath:nil error:&error]).to.equal(3);
+    BOOL success = [self.importer finishImporting:&error];
+    expect(success).to.equal(YES);
+    expect(error).to.beNil();
+
+    // Both sides of the inverse relationship are connected in the importer's context
+    expect([self importedValuesForKeyPath:@"human.railsID" ofEntityForName:@"Cat"]).to.equal((@[ @2, @1, @2 ]));
+    expect([self importedValuesForKeyPath:@"cats.@count" ofEntityForName:@"Human"]).to.equal((@[ @1, @2 ]));
+}
+
+@end
@@ -960,6 +960,60 @@
     }];
 }
 
+- (void)testMappingACollectionPreparesTargetObjectsWithFetchRequestMappingCache
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                                      cache:managedObjectCache];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name" }];
+
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    human.railsID = @1;
+    human.name = @"Blake";
+    [managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    id mockCache = [OCMockObject partialMockForObject:managedObjectCache];
+    [[[mockCache expect] andForwardToRealObject] managedObjectsWithEntity:OCMOCK_ANY attributeValuesCollection:OCMOCK_ANY inManagedObjectContext:OCMOCK_ANY];
+    [[mockCache reject] managedObjectsWithEntity:OCMOCK_ANY attributeValues:OCMOCK_ANY inManagedObjectContext:OCMOCK_ANY];
+
+    NSArray *representations = @[ @{ @"id": @1, @"name": @"Blake Watters" }, @{ @"id": @2, @"name": @"Sarah" }, @{ @"id": @2, @"name": @"Sarah Watters" } ];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"humans": representations } mappingsDictionary:@{ @"humans": mapping }];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    [mapper start];
+    [mockCache verify];
+
+    NSArray *humans = [mapper.mappingResult array];
+    expect(humans).to.haveCountOf(3);
+    expect([humans objectAtIndex:0]).to.equal(human);
+    expect(human.name).to.equal(@"Blake Watters");
+    expect([humans objectAtIndex:1]).to.beIdenticalTo([humans objectAtIndex:2]);
+    NSUInteger count = [managedObjectStore.persistentStoreManagedObjectContext countForEntityForName:@"Human" predicate:nil error:nil];
+    expect(count).to.equal(2);
+}
+
+- (void)testMappingACollectionDiscardsThePreparedTargetObjectsOnceTheCollectionIsMapped
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                                      cache:managedObjectCache];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name" }];
+
+    NSArray *representations = @[ @{ @"id": @1, @"name": @"Blake" }, @{ @"id": @2, @"name": @"Sarah" } ];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"humans": representations } mappingsDictionary:@{ @"humans": mapping }];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    [mapper start];
+
+    expect([mapper.mappingResult array]).to.haveCountOf(2);
+    NSDictionary *preparedManagedObjectsByEntityName = [mappingOperationDataSource valueForKey:@"preparedManagedObjectsByEntityName"];
+    expect([preparedManagedObjectsByEntityName objectForKey:@"Human"]).to.beNil();
+}
+
 - (void)testMappingAPayloadContainingRepeatedObjectsDoesNotYieldDuplicatesWithFetchRequestMappingCache
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -1391,6 +1445,40 @@
     expect([blake valueForKey:@"favoriteCat"]).to.equal([mapper.mappingResult.dictionary objectForKey:@"cat"]);
 }
 
+- (void)testConnectionsOfAllObjectsMappedByParentOperationAreEstablishedInOneBatch
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKFetchRequestManagedObjectCache *managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKManagedObjectMappingOperationDataSource *mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                                      cache:managedObjectCache];
+    NSOperationQueue *operationQueue = [NSOperationQueue new];
+    [operationQueue setSuspended:YES];
+    mappingOperationDataSource.operationQueue = operationQueue;
+
+    RKCat *asia = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    asia.railsID = @1;
+    RKCat *reginald = [NSEntityDescription insertNewObjectForEntityForName:@"Cat" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    reginald.railsID = @2;
+    [managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    NSArray *representation = @[ @{ @"name": @"Blake", @"favoriteCatID": @1 }, @{ @"name": @"Sarah", @"favoriteCatID": @2 }, @{ @"name": @"Jeff", @"favoriteCatID": @1 }, @{ @"name": @"Dan", @"favoriteCatID": @3 } ];
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanMapping addAttributeMappingsFromArray:@[ @"name", @"favoriteCatID" ]];
+    [humanMapping addConnectionForRelationship:@"favoriteCat" connectedBy:@{ @"favoriteCatID": @"railsID" }];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ [NSNull null]: humanMapping }];
+    mapper.mappingOperationDataSource = mappingOperationDataSource;
+    mappingOperationDataSource.parentOperation = mapper;
+    [mapper start];
+
+    expect([operationQueue operationCount]).to.equal(1);
+    [operationQueue setSuspended:NO];
+    [operationQueue waitUntilAllOperationsAreFinished];
+
+    NSArray *humans = [mapper.mappingResult array];
+    expect([humans valueForKey:@"favoriteCat"]).to.equal(@[ asia, reginald, asia, [NSNull null] ]);
+    expect(managedObjectCache.fetchCount).to.equal(1);
+}
+
 - (void)testDeletionOperationAfterManagedObjectContextIsDeallocated
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
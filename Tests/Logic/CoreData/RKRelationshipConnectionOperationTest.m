@@ -256,6 +256,30 @@
     expect(secondChild.friends).to.equal(expectedFriends);
 }
 
+- (void)testConnectingToManyRelationshipByCollectionOfIdentifiersLooksUpEachIdentifierOnceInOneRequest
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSEntityDescription *childEntity = [NSEntityDescription entityForName:@"Child" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    NSRelationshipDescription *relationship = [childEntity relationshipsByName][@"friends"];
+    RKConnectionDescription *connection = [[RKConnectionDescription alloc] initWithRelationship:relationship attributes:@{ @"friendIDs": @"railsID" }];
+
+    RKHuman *blake = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:nil withProperties:nil];
+    blake.railsID = @(1);
+    RKHuman *sarah = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:nil withProperties:nil];
+    sarah.railsID = @(2);
+
+    RKChild *child = [RKTestFactory insertManagedObjectForEntityForName:@"Child" inManagedObjectContext:nil withProperties:nil];
+    child.friendIDs = @[ @(1), @(2), @(1), [NSNull null], @(3) ];
+
+    RKFetchRequestManagedObjectCache *managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKRelationshipConnectionOperation *operation = [[RKRelationshipConnectionOperation alloc] initWithManagedObject:child connections:@[ connection ] managedObjectCache:managedObjectCache];
+    [operation start];
+
+    NSSet *expectedFriends = [NSSet setWithObjects:blake, sarah, nil];
+    expect(child.friends).to.equal(expectedFriends);
+    expect(managedObjectCache.fetchCount).to.equal(1);
+}
+
 - (void)testConnectionWithSourcePredicate
 {
     RKHuman *human = [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:nil withProperties:nil];
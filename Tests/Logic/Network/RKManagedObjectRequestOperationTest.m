@@ -643,6 +643,37 @@ NSSet *RKSetByRemovingSubkeypathsFromSet(NSSet *setOfKeyPaths);
     expect(orphanedHuman.managedObjectContext).to.beNil();
 }
 
+- (void)testDeletionOfMoreOrphanedManagedObjectsThanFitInOneBatch
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    for (NSUInteger i = 0; i < 1200; i++) {
+        [RKTestFactory insertManagedObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext withProperties:@{ @"railsID": @(i) }];
+    }
+    [managedObjectContext save:nil];
+    RKHuman *unsavedOrphanedHuman = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    RKEntityMapping *entityMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [entityMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:entityMapping method:RKRequestMethodAny pathPattern:nil keyPath:@"human" statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"/JSON/humans/with_to_one_relationship.json" relativeToURL:[RKTestFactory baseURL]]];
+    RKManagedObjectRequestOperation *managedObjectRequestOperation = [[RKManagedObjectRequestOperation alloc] initWithRequest:request responseDescriptors:@[ responseDescriptor ]];
+    RKFetchRequestBlock fetchRequestBlock = ^NSFetchRequest * (NSURL *URL) {
+        return [NSFetchRequest fetchRequestWithEntityName:@"Human"];
+    };
+    managedObjectRequestOperation.fetchRequestBlocks = @[ fetchRequestBlock ];
+    managedObjectRequestOperation.managedObjectContext = managedObjectContext;
+    [managedObjectRequestOperation start];
+    [managedObjectRequestOperation waitUntilFinished];
+    expect(managedObjectRequestOperation.error).to.beNil();
+    expect([managedObjectRequestOperation.mappingResult array]).to.haveCountOf(1);
+    expect(unsavedOrphanedHuman.managedObjectContext).to.beNil();
+
+    NSArray *humans = [managedObjectContext executeFetchRequest:[NSFetchRequest fetchRequestWithEntityName:@"Human"] error:nil];
+    expect(humans).to.haveCountOf(1);
+    expect([[humans lastObject] objectID]).to.equal([[managedObjectRequestOperation.mappingResult firstObject] objectID]);
+}
+
 - (void)testDeletionOfOrphanedObjectsMappedOnRelationships
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -143,4 +143,51 @@
     assertThat(NSStringFromClass(mapping.objectClass), is(equalTo(@"Boy")));
 }
 
+- (void)testThatIndexedKeyPathMatchersPreserveRegistrationOrderWithPredicateMatchers
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    RKObjectMappingMatcher *predicateMatcher = [RKObjectMappingMatcher matcherWithPredicate:[NSPredicate predicateWithFormat:@"name = 'Blake'"] objectMapping:girlMapping];
+    RKObjectMappingMatcher *girlMatcher = [RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Girl" objectMapping:girlMapping];
+    RKObjectMappingMatcher *boyMatcher = [RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Boy" objectMapping:boyMapping];
+    [dynamicMapping addMatcher:girlMatcher];
+    [dynamicMapping addMatcher:predicateMatcher];
+    [dynamicMapping addMatcher:boyMatcher];
+
+    // The predicate is registered ahead of the boy matcher and wins
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"name": @"Blake" }]).to.equal(girlMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"name": @"Sarah" }]).to.equal(boyMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Girl", @"name": @"Sarah" }]).to.equal(girlMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Robot" }]).to.beNil();
+
+    // Moving the boy matcher to the top of the stack takes precedence over the predicate
+    [dynamicMapping addMatcher:boyMatcher];
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"name": @"Blake" }]).to.equal(boyMapping);
+
+    [dynamicMapping removeMatcher:boyMatcher];
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"name": @"Sarah" }]).to.beNil();
+}
+
+- (void)testThatMatchCountsAreTrackedPerMatcher
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    RKObjectMappingMatcher *girlMatcher = [RKObjectMappingMatcher matcherWithKeyPath:@"numeric_type" expectedValue:@(0) objectMapping:girlMapping];
+    RKObjectMappingMatcher *boyMatcher = [RKObjectMappingMatcher matcherWithPredicate:[NSPredicate predicateWithFormat:@"numeric_type = 1"] objectMapping:boyMapping];
+    [dynamicMapping addMatcher:girlMatcher];
+    [dynamicMapping addMatcher:boyMatcher];
+
+    [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"girl.json"]];
+    [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"girl.json"]];
+    [dynamicMapping objectMappingForRepresentation:[RKTestFixture parsedObjectWithContentsOfFixture:@"boy.json"]];
+    expect([dynamicMapping numberOfMatchesForMatcher:girlMatcher]).to.equal(2);
+    expect([dynamicMapping numberOfMatchesForMatcher:boyMatcher]).to.equal(1);
+
+    [dynamicMapping resetMatchCounts];
+    expect([dynamicMapping numberOfMatchesForMatcher:girlMatcher]).to.equal(0);
+    expect([dynamicMapping numberOfMatchesForMatcher:boyMatcher]).to.equal(0);
+}
+
 @end
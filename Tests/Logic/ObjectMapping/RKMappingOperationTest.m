@@ -18,6 +18,7 @@
 //  limitations under the License.
 //
 
+#import <objc/runtime.h>
 #import "RKTestEnvironment.h"
 #import "RKMappingErrors.h"
 #import "RKMappableObject.h"
@@ -25,6 +26,7 @@
 #import "RKObjectMappingOperationDataSource.h"
 #import "RKTestAddress.h"
 #import "RKTestUser.h"
+#import "RKPropertyInspector.h"
 
 @interface TestMappable : NSObject {
     NSURL *_url;
@@ -70,6 +72,19 @@
 
 @end
 
+@interface RKTestKeyValueObserver : NSObject
+@property (nonatomic, assign) NSUInteger observedChangeCount;
+@end
+
+@implementation RKTestKeyValueObserver
+
+- (void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary *)change context:(void *)context
+{
+    self.observedChangeCount++;
+}
+
+@end
+
 @interface RKObjectMappingOperationTest : RKTestCase {
 
 }
@@ -570,4 +585,115 @@
     assertThat(newObject.url, is(equalTo([NSURL URLWithString:@"http://www.restkit.org/test"])));
 }
 
+- (void)testMappingDictionaryKeyPathsAlongsideRootKeyPaths
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"user.name": @"name", @"user.email": @"emailAddress", @"user.missing": @"website", @"@root.lucky": @"luckyNumber" }];
+    NSDictionary *representation = @{ @"user": @{ @"name": @"Blake", @"email": @"blake@restkit.org" }, @"lucky": @7 };
+    RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:nil mapping:userMapping];
+    mappingOperation.dataSource = [RKObjectMappingOperationDataSource new];
+    [mappingOperation start];
+    expect(mappingOperation.error).to.beNil();
+    RKTestUser *blake = mappingOperation.destinationObject;
+    expect(blake.name).to.equal(@"Blake");
+    expect(blake.emailAddress).to.equal(@"blake@restkit.org");
+    expect(blake.website).to.beNil();
+    expect(blake.luckyNumber).to.equal(@7);
+}
+
+- (void)testPropertyInspectionCanBeReadConcurrently
+{
+    RKPropertyInspector *inspector = [RKPropertyInspector new];
+    NSDictionary *inspection = [inspector propertyInspectionForClass:[RKTestUser class]];
+    RKPropertyInspection *ageInspection = [inspection objectForKey:@"age"];
+    expect(ageInspection.keyValueCodingClass).to.equal([NSNumber class]);
+    expect(ageInspection.isPrimitive).to.beTruthy();
+    expect(ageInspection[RKPropertyInspectionIsPrimitiveKey]).to.equal(@YES);
+    expect([inspection objectForKey:@"name"][RKPropertyInspectionKeyValueCodingClassKey]).to.equal([NSString class]);
+
+    // Each iteration records its own result so that the test itself is free of data races
+    NSMutableData *matchData = [NSMutableData dataWithLength:100 * sizeof(BOOL)];
+    BOOL *matches = [matchData mutableBytes];
+    dispatch_apply(100, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        matches[iteration] = ([inspector classForPropertyNamed:@"emailAddress" ofClass:[RKTestUser class] isPrimitive:NULL] == [NSString class]);
+    });
+    NSUInteger mismatches = 0;
+    for (NSUInteger iteration = 0; iteration < 100; iteration++) {
+        if (! matches[iteration]) mismatches++;
+    }
+    expect(mismatches).to.equal(0);
+}
+
+- (void)testPropertyAccessorBoxesAndUnboxesPrimitiveValues
+{
+    RKTestUser *user = [RKTestUser new];
+    RKPropertyAccessor *ageAccessor = [[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"age" ofClass:[RKTestUser class]];
+    expect(ageAccessor).notTo.beNil();
+    expect(ageAccessor.isPrimitive).to.beTruthy();
+    [ageAccessor setValue:@31 forObject:user];
+    expect(user.age).to.equal(31);
+    expect([ageAccessor valueForObject:user]).to.equal([user valueForKey:@"age"]);
+
+    RKPropertyAccessor *nameAccessor = [[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"name" ofClass:[RKTestUser class]];
+    expect(nameAccessor.isPrimitive).to.beFalsy();
+    [nameAccessor setValue:@"Blake" forObject:user];
+    expect([nameAccessor valueForObject:user]).to.equal(@"Blake");
+}
+
+- (void)testPropertyAccessorIsNotAvailableForClassesCustomizingKeyValueCoding
+{
+    expect([[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"count" ofClass:[NSMutableDictionary class]]).to.beNil();
+    expect([[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"missing" ofClass:[RKTestUser class]]).to.beNil();
+}
+
+- (void)testMappingAttributesThroughPropertyAccessorsNotifiesKeyValueObservers
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"age" ]];
+    RKTestUser *user = [RKTestUser new];
+    RKTestKeyValueObserver *observer = [RKTestKeyValueObserver new];
+    [user addObserver:observer forKeyPath:@"name" options:0 context:nil];
+    [user addObserver:observer forKeyPath:@"age" options:0 context:nil];
+
+    RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"age": @31 } destinationObject:user mapping:mapping];
+    mappingOperation.dataSource = [RKObjectMappingOperationDataSource new];
+    [mappingOperation start];
+    [user removeObserver:observer forKeyPath:@"name"];
+    [user removeObserver:observer forKeyPath:@"age"];
+
+    expect(mappingOperation.error).to.beNil();
+    expect(user.name).to.equal(@"Blake");
+    expect(user.age).to.equal(31);
+    expect(observer.observedChangeCount).to.equal(2);
+}
+
+- (void)testMappingNotifiesKeyValueObserversAddedAfterThePropertyAccessorWasCached
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"age" ]];
+    RKTestUser *user = [RKTestUser new];
+    RKTestKeyValueObserver *nameObserver = [RKTestKeyValueObserver new];
+    [user addObserver:nameObserver forKeyPath:@"name" options:0 context:nil];
+
+    // Resolves the accessors of the key-value observing subclass before its setter of `age` is overridden
+    RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"age": @31 } destinationObject:user mapping:mapping];
+    mappingOperation.dataSource = [RKObjectMappingOperationDataSource new];
+    [mappingOperation start];
+    RKPropertyAccessor *staleAccessor = [[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"age" ofClass:object_getClass(user)];
+    expect(staleAccessor).notTo.beNil();
+
+    RKTestKeyValueObserver *ageObserver = [RKTestKeyValueObserver new];
+    [user addObserver:ageObserver forKeyPath:@"age" options:0 context:nil];
+    expect([[RKPropertyInspector sharedInspector] propertyAccessorForPropertyNamed:@"age" ofClass:object_getClass(user)] == staleAccessor).to.beFalsy();
+    mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"age": @32 } destinationObject:user mapping:mapping];
+    mappingOperation.dataSource = [RKObjectMappingOperationDataSource new];
+    [mappingOperation start];
+    [user removeObserver:nameObserver forKeyPath:@"name"];
+    [user removeObserver:ageObserver forKeyPath:@"age"];
+
+    expect(mappingOperation.error).to.beNil();
+    expect(user.age).to.equal(32);
+    expect(ageObserver.observedChangeCount).to.equal(1);
+}
+
 @end
@@ -31,6 +31,8 @@
 #import "RKPost.h"
 #import "RKObjectRequestOperation.h"
 #import "RKManagedObjectRequestOperation.h"
+#import "RKInMemoryManagedObjectCache.h"
+#import "RKEntityCache.h"
 
 @interface RKSubclassedTestModel : RKObjectMapperTestModel
 @end
@@ -1551,6 +1553,44 @@
     expect(human.weight).will.equal(@131.3);
 }
 
+- (void)testPrewarmingInvokesCompletionOnMainQueue
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:userMapping method:RKRequestMethodGET pathPattern:@"/users/:userID" keyPath:nil statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+    [self.objectManager addResponseDescriptor:responseDescriptor];
+
+    __block BOOL completedOnMainThread = NO;
+    [self.objectManager prewarmWithCompletion:^{
+        completedOnMainThread = [NSThread isMainThread];
+    }];
+    expect(completedOnMainThread).will.beTruthy();
+
+    // The compiled path matcher is shared between matches
+    expect([responseDescriptor matchesPath:@"/users/1"]).to.beTruthy();
+    expect([responseDescriptor matchesPath:@"/users/2"]).to.beTruthy();
+    expect([responseDescriptor matchesPath:@"/users/1/friends"]).to.beFalsy();
+}
+
+- (void)testPrewarmingLoadsInMemoryManagedObjectCacheForEntityMappings
+{
+    RKManagedObjectStore *managedObjectStore = self.objectManager.managedObjectStore;
+    RKInMemoryManagedObjectCache *managedObjectCache = [[RKInMemoryManagedObjectCache alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    managedObjectStore.managedObjectCache = managedObjectCache;
+    RKEntityMapping *humanMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    humanMapping.identificationAttributes = @[ @"railsID" ];
+    [humanMapping addAttributeMappingsFromArray:@[ @"name", @"railsID" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:humanMapping method:RKRequestMethodGET pathPattern:@"/humans/:railsID" keyPath:@"human" statusCodes:RKStatusCodeIndexSetForClass(RKStatusCodeClassSuccessful)];
+    [self.objectManager addResponseDescriptor:responseDescriptor];
+
+    __block BOOL completed = NO;
+    [self.objectManager prewarmWithCompletion:^{
+        completed = YES;
+    }];
+    expect(completed).will.beTruthy();
+    expect([managedObjectCache.entityCache isEntity:humanMapping.entity cachedByAttributes:@[ @"railsID" ]]).to.beTruthy();
+}
+
 @end
 
 @interface RKObjectManagerNonCoreDataTest: RKTestCase
@@ -22,6 +22,7 @@
 #import <OCMock/NSNotificationCenter+OCMAdditions.h>
 #import "RKTestEnvironment.h"
 #import "RKObjectMapping.h"
+#import "RKObjectMappingPlan.h"
 #import "RKMappingOperation.h"
 #import "RKAttributeMapping.h"
 #import "RKRelationshipMapping.h"
@@ -262,6 +263,55 @@
     assertThat(blake.name, is(equalTo(@"Blake Watters")));
 }
 
+- (void)testShouldMapACollectionOfSimpleObjectDictionariesConcurrently
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"name": @"name" }];
+
+    NSMutableArray *representations = [NSMutableArray arrayWithCapacity:500];
+    for (NSUInteger index = 0; index < 500; index++) {
+        [representations addObject:@{ @"id": @(index), @"name": [NSString stringWithFormat:@"User %ld", (long) index] }];
+    }
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: mapping }];
+    mapper.mapsCollectionsConcurrently = YES;
+    [mapper start];
+
+    NSArray *users = [mapper.mappingResult array];
+    expect(users).to.haveCountOf(500);
+    expect([users valueForKey:@"userID"]).to.equal([representations valueForKey:@"id"]);
+    expect([users valueForKey:@"name"]).to.equal([representations valueForKey:@"name"]);
+    expect([[mapper.mappingInfo objectForKey:[NSNull null]] count]).to.equal(500);
+}
+
+- (void)testReadingSourceValuesThroughTheMappingPlanMatchesKeyValueCoding
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"name": @"name", @"user.email": @"emailAddress", @"address.city": @"country", @"missing.key": @"website" }];
+
+    NSMutableArray *representations = [NSMutableArray arrayWithCapacity:1000];
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [representations addObject:@{ @"id": @(index), @"name": [NSString stringWithFormat:@"User %ld", (long) index],
+                                      @"user": @{ @"email": [NSString stringWithFormat:@"user%ld@restkit.org", (long) index] },
+                                      @"address": @{ @"city": @"Carrboro" } }];
+    }
+
+    NSUInteger mismatchCount = 0;
+    for (NSDictionary *representation in representations) {
+        for (RKPlannedPropertyMapping *plannedMapping in [mapping mappingPlan].attributeMappings) {
+            id keyValueCodingValue = [representation valueForKeyPath:plannedMapping.propertyMapping.sourceKeyPath];
+            id mappingPlanValue = [plannedMapping sourceValueFromRepresentation:representation];
+            if (mappingPlanValue != keyValueCodingValue && ! [mappingPlanValue isEqual:keyValueCodingValue]) mismatchCount++;
+        }
+    }
+    expect(mismatchCount).to.equal(0);
+
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: mapping }];
+    [mapper start];
+    NSArray *users = [mapper.mappingResult array];
+    expect(users).to.haveCountOf(1000);
+    expect([users valueForKey:@"emailAddress"]).to.equal([representations valueForKeyPath:@"user.email"]);
+}
+
 - (void)testShouldDetermineTheObjectMappingByConsultingTheMappingProviderWhenThereIsATargetObject
 {
     RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
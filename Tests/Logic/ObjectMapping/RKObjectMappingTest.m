@@ -9,6 +9,7 @@
 #import "RKTestEnvironment.h"
 #import "RKTestUser.h"
 #import "RKObjectMappingOperationDataSource.h"
+#import "RKObjectMappingPlan.h"
 
 @interface RKObjectMappingTest : RKTestCase
 
@@ -254,4 +255,96 @@
     expect(operation.destinationObject).to.equal(@{ @"Blake": @{} });
 }
 
+- (void)testMappingPlanPartitionsAttributeAndRelationshipMappings
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"user.email": @"emailAddress" }];
+    [mapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"address" toKeyPath:@"address" withMapping:addressMapping]];
+
+    RKObjectMappingPlan *mappingPlan = [mapping mappingPlan];
+    expect([mappingPlan.simpleAttributeMappings valueForKeyPath:@"propertyMapping.sourceKeyPath"]).to.equal(@[ @"name" ]);
+    expect([mappingPlan.keyPathAttributeMappings valueForKeyPath:@"propertyMapping.sourceKeyPath"]).to.equal(@[ @"user.email" ]);
+    expect([mappingPlan.relationshipMappings valueForKeyPath:@"propertyMapping.sourceKeyPath"]).to.equal(@[ @"address" ]);
+    expect([[mappingPlan plannedMappingForSourceKeyPath:@"user.email"] sourceKeyPathComponents]).to.equal(@[ @"user", @"email" ]);
+    expect([[mappingPlan plannedMappingForDestinationKeyPath:@"address"] destinationClass]).to.equal([RKTestAddress class]);
+}
+
+- (void)testMappingPlanIsCachedUntilPropertyMappingsChange
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKObjectMappingPlan *mappingPlan = [mapping mappingPlan];
+    expect([mapping mappingPlan]).to.beIdenticalTo(mappingPlan);
+
+    RKAttributeMapping *attributeMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"email" toKeyPath:@"emailAddress"];
+    [mapping addPropertyMapping:attributeMapping];
+    expect([mapping mappingPlan]).notTo.beIdenticalTo(mappingPlan);
+    expect([mapping mappingPlan].attributeMappings).to.haveCountOf(2);
+
+    mappingPlan = [mapping mappingPlan];
+    [mapping removePropertyMapping:attributeMapping];
+    expect([mapping mappingPlan]).notTo.beIdenticalTo(mappingPlan);
+    expect([mapping mappingPlan].attributeMappings).to.haveCountOf(1);
+}
+
+- (void)testMappingPlanSourceValuesMatchKeyValueCoding
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"user.name": @"name", @"friends.name": @"interests", @"groups.@unionOfArrays.members": @"favoriteColors", @"friends.@count": @"luckyNumber" }];
+    NSDictionary *representation = @{ @"user": @{ @"name": @"Blake" },
+                                      @"friends": @[ @{ @"name": @"Jeff" }, @{ @"email": @"dan@restkit.org" } ],
+                                      @"groups": @[ @{ @"members": @[ @"a", @"b" ] }, @{ @"members": @[ @"c" ] } ] };
+
+    RKObjectMappingPlan *mappingPlan = [mapping mappingPlan];
+    for (RKPlannedPropertyMapping *plannedMapping in mappingPlan.attributeMappings) {
+        expect(plannedMapping.readsSourceValueDirectly).to.beTruthy();
+        id expectedValue = [representation valueForKeyPath:plannedMapping.propertyMapping.sourceKeyPath];
+        expect([plannedMapping sourceValueFromRepresentation:representation]).to.equal(expectedValue);
+    }
+    expect([[mappingPlan plannedMappingForSourceKeyPath:@"friends.name"] sourceValueFromRepresentation:representation]).to.equal(@[ @"Jeff", [NSNull null] ]);
+}
+
+- (void)testMappingPlanDoesNotReadRootAndParentKeyPathsDirectly
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"@root.name": @"name", @"@parent.email": @"emailAddress" }];
+    for (RKPlannedPropertyMapping *plannedMapping in [mapping mappingPlan].attributeMappings) {
+        expect(plannedMapping.readsSourceValueDirectly).to.beFalsy();
+    }
+}
+
+- (void)testPropertyMappingCollectionsAreCachedUntilPropertyMappingsChange
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"email": @"emailAddress" }];
+    NSArray *attributeMappings = mapping.attributeMappings;
+    NSDictionary *propertyMappingsBySourceKeyPath = mapping.propertyMappingsBySourceKeyPath;
+    expect(mapping.attributeMappings).to.beIdenticalTo(attributeMappings);
+    expect(mapping.propertyMappingsBySourceKeyPath).to.beIdenticalTo(propertyMappingsBySourceKeyPath);
+
+    RKRelationshipMapping *relationshipMapping = [RKRelationshipMapping relationshipMappingFromKeyPath:@"friends" toKeyPath:@"friends" withMapping:mapping];
+    [mapping addPropertyMapping:relationshipMapping];
+    expect(mapping.attributeMappings).notTo.beIdenticalTo(attributeMappings);
+    expect(mapping.relationshipMappings).to.equal(@[ relationshipMapping ]);
+    expect([mapping mappingForSourceKeyPath:@"friends"]).to.beIdenticalTo(relationshipMapping);
+    expect([mapping mappingForDestinationKeyPath:@"emailAddress"]).to.beIdenticalTo([mapping.propertyMappingsBySourceKeyPath objectForKey:@"email"]);
+
+    [mapping removePropertyMapping:relationshipMapping];
+    expect(mapping.relationshipMappings).to.haveCountOf(0);
+    expect([mapping mappingForSourceKeyPath:@"friends"]).to.beNil();
+}
+
+- (void)testAddingAPropertyMappingForARemovedDestinationKeyPathIsAllowed
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    RKAttributeMapping *attributeMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"name" toKeyPath:@"name"];
+    [mapping addPropertyMapping:attributeMapping];
+    STAssertThrowsSpecificNamed([mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"username" toKeyPath:@"name"]], NSException, NSInternalInconsistencyException, @"Cannot add a second mapping for a destination key path.");
+
+    [mapping removePropertyMapping:attributeMapping];
+    [mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"username" toKeyPath:@"name"]];
+    expect([[mapping mappingForDestinationKeyPath:@"name"] sourceKeyPath]).to.equal(@"username");
+}
+
 @end
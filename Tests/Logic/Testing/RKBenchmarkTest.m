@@ -0,0 +1,341 @@
+//
+//  RKBenchmarkTest.m
+//  RestKit
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKBenchmark.h"
+#import "RKLog.h"
+#import "RKObjectMappingOperationDataSource.h"
+#import "RKObjectMappingPlan.h"
+#import "RKObjectParameterization.h"
+#import "RKPathMatcher.h"
+#import "RKEntityByAttributeCache.h"
+#import "RKSearchIndexer.h"
+#import "RKTestUser.h"
+#import "RKTestAddress.h"
+#import "RKHuman.h"
+#import "RKDynamicMappingModels.h"
+
+// The benchmark suite only runs when a results path is given, so that the regular test run is not slowed down
+static NSString * const RKBenchmarkResultsPathEnvironmentKey = @"RK_BENCHMARK_RESULTS_PATH";
+static NSString * const RKBenchmarkObjectCountsEnvironmentKey = @"RK_BENCHMARK_OBJECT_COUNTS";
+static NSUInteger const RKBenchmarkIterationCount = 3;
+static NSTimeInterval const RKBenchmarkWaitTimeout = 120.0;
+
+static NSArray *RKBenchmarkObjectCounts(void)
+{
+    NSString *objectCounts = [[[NSProcessInfo processInfo] environment] objectForKey:RKBenchmarkObjectCountsEnvironmentKey];
+    if (! objectCounts) return @[ @1000, @10000, @100000 ];
+    return [[objectCounts componentsSeparatedByString:@","] valueForKey:@"integerValue"];
+}
+
+static NSArray *RKBenchmarkUserRepresentations(NSUInteger count)
+{
+    NSMutableArray *representations = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [representations addObject:@{ @"id": @(i),
+                                      @"name": [NSString stringWithFormat:@"User %lu", (unsigned long)i],
+                                      @"email": [NSString stringWithFormat:@"user%lu@restkit.org", (unsigned long)i],
+                                      @"type": (i % 2) ? @"Boy" : @"Girl",
+                                      @"address": @{ @"id": @(i), @"city": @"Carrboro", @"state": @"North Carolina", @"country": @"USA" } }];
+    }
+    return representations;
+}
+
+static NSManagedObjectModel *RKBenchmarkManagedObjectModel(void)
+{
+    NSURL *modelURL = [[RKTestFixture fixtureBundle] URLForResource:@"Data Model" withExtension:@"mom"];
+    return [[NSManagedObjectModel alloc] initWithContentsOfURL:modelURL];
+}
+
+// Raises if the condition is not met within the timeout, so that a lost completion fails the benchmark rather than hanging the suite
+static void RKBenchmarkWaitUntil(NSString *description, BOOL (^condition)(void))
+{
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:RKBenchmarkWaitTimeout];
+    while (! condition()) {
+        if ([deadline timeIntervalSinceNow] < 0) {
+            [NSException raise:NSInternalInconsistencyException format:@"Timed out after %.0f seconds waiting for %@", RKBenchmarkWaitTimeout, description];
+        }
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+}
+
+@interface RKBenchmarkTest : RKTestCase
+@property (nonatomic, strong) NSMutableArray *benchmarks;
+@end
+
+@implementation RKBenchmarkTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+    self.benchmarks = [NSMutableArray array];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (RKObjectMapping *)userMapping
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"name": @"name", @"email": @"emailAddress" }];
+    return mapping;
+}
+
+- (RKBenchmark *)benchmarkWithName:(NSString *)name objectCount:(NSUInteger)objectCount executionBlock:(void (^)(void))block
+{
+    RKBenchmark *benchmark = [RKBenchmark benchmarkWithName:[NSString stringWithFormat:@"%@ (%lu objects)", name, (unsigned long)objectCount]];
+    [benchmark runIterations:RKBenchmarkIterationCount objectCount:objectCount executionBlock:block];
+    RKLogInfo(@"Benchmark '%@': %.0f ops/sec, %.2f live blocks/object, %.0f live bytes/object", benchmark.name, benchmark.operationsPerSecond, benchmark.liveBlocksPerObject, benchmark.liveBytesPerObject);
+    [self.benchmarks addObject:benchmark];
+    return benchmark;
+}
+
+- (void)benchmarkMappingOperationsWithName:(NSString *)name mapping:(RKMapping *)mapping representations:(NSArray *)representations destinationClass:(Class)destinationClass
+{
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+    [self benchmarkWithName:name objectCount:[representations count] executionBlock:^{
+        for (NSDictionary *representation in representations) {
+            RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:[destinationClass new] mapping:mapping];
+            operation.dataSource = dataSource;
+            [operation start];
+        }
+    }];
+}
+
+#pragma mark - RKBenchmark
+
+- (void)testRunningIterationsRecordsThroughput
+{
+    RKBenchmark *benchmark = [RKBenchmark benchmarkWithName:@"Allocating strings"];
+    __block NSUInteger executionCount = 0;
+    [benchmark runIterations:4 objectCount:100 executionBlock:^{
+        executionCount++;
+        for (NSUInteger i = 0; i < 100; i++) {
+            [NSString stringWithFormat:@"%lu", (unsigned long)i];
+        }
+    }];
+    expect(executionCount).to.equal(4);
+    expect(benchmark.iterations).to.equal(4);
+    expect(benchmark.objectCount).to.equal(100);
+    expect(benchmark.operationsPerSecond).to.beGreaterThan(0);
+
+    NSDictionary *dictionary = [benchmark dictionaryRepresentation];
+    expect([dictionary objectForKey:@"name"]).to.equal(@"Allocating strings");
+    expect([dictionary objectForKey:@"objectCount"]).to.equal(100);
+}
+
+- (void)testWritingBenchmarksAsJSON
+{
+    RKBenchmark *benchmark = [RKBenchmark benchmarkWithName:@"Doing nothing"];
+    [benchmark runIterations:1 objectCount:1 executionBlock:^{}];
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"RKBenchmarkTest.json"];
+    NSError *error = nil;
+    BOOL success = [RKBenchmark writeBenchmarks:@[ benchmark ] toFileAtPath:path error:&error];
+    expect(success).to.equal(YES);
+    expect(error).to.beNil();
+
+    NSArray *results = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfFile:path] options:0 error:nil];
+    expect(results).to.haveCountOf(1);
+    expect([results valueForKey:@"name"]).to.equal(@[ @"Doing nothing" ]);
+}
+
+#pragma mark - Benchmark Suite
+
+- (void)testMappingEngineBenchmarkSuite
+{
+    NSString *resultsPath = [[[NSProcessInfo processInfo] environment] objectForKey:RKBenchmarkResultsPathEnvironmentKey];
+    if (! resultsPath) return;
+
+    for (NSNumber *objectCount in RKBenchmarkObjectCounts()) {
+        NSUInteger count = [objectCount unsignedIntegerValue];
+        NSArray *representations = RKBenchmarkUserRepresentations(count);
+        [self benchmarkObjectMappingWithRepresentations:representations];
+        [self benchmarkParameterizationAndPathMatchingWithRepresentations:representations];
+        [self benchmarkEntityByAttributeCacheWithObjectCount:count];
+        [self benchmarkSearchIndexerWithObjectCount:count];
+    }
+
+    NSError *error = nil;
+    BOOL success = [RKBenchmark writeBenchmarks:self.benchmarks toFileAtPath:resultsPath error:&error];
+    expect(success).to.equal(YES);
+    expect(error).to.beNil();
+}
+
+- (void)benchmarkObjectMappingWithRepresentations:(NSArray *)representations
+{
+    RKObjectMapping *flatMapping = [self userMapping];
+    [self benchmarkMappingOperationsWithName:@"RKMappingOperation flat" mapping:flatMapping representations:representations destinationClass:[RKTestUser class]];
+
+    RKObjectMapping *nestedMapping = [self userMapping];
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromDictionary:@{ @"id": @"addressID", @"city": @"city", @"state": @"state", @"country": @"country" }];
+    [nestedMapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"address" toKeyPath:@"address" withMapping:addressMapping]];
+    [self benchmarkMappingOperationsWithName:@"RKMappingOperation nested" mapping:nestedMapping representations:representations destinationClass:[RKTestUser class]];
+
+    RKObjectMapping *keyPathMapping = [self userMapping];
+    [keyPathMapping addAttributeMappingsFromDictionary:@{ @"address.country": @"country" }];
+    [self benchmarkMappingOperationsWithName:@"RKMappingOperation key path" mapping:keyPathMapping representations:representations destinationClass:[RKTestUser class]];
+
+    // Compares reading the source values of a mapping through its plan with reading them by key-value coding
+    NSArray *attributeMappings = [keyPathMapping mappingPlan].attributeMappings;
+    [self benchmarkWithName:@"Source values by key-value coding" objectCount:[representations count] executionBlock:^{
+        for (NSDictionary *representation in representations) {
+            for (RKPlannedPropertyMapping *plannedMapping in attributeMappings) {
+                [representation valueForKeyPath:plannedMapping.propertyMapping.sourceKeyPath];
+            }
+        }
+    }];
+    [self benchmarkWithName:@"Source values by RKObjectMappingPlan" objectCount:[representations count] executionBlock:^{
+        for (NSDictionary *representation in representations) {
+            for (RKPlannedPropertyMapping *plannedMapping in attributeMappings) {
+                [plannedMapping sourceValueFromRepresentation:representation];
+            }
+        }
+    }];
+
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    [girlMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    [boyMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Girl" objectMapping:girlMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Boy" objectMapping:boyMapping]];
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+    [self benchmarkWithName:@"RKMappingOperation dynamic" objectCount:[representations count] executionBlock:^{
+        for (NSDictionary *representation in representations) {
+            RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:nil mapping:dynamicMapping];
+            operation.dataSource = dataSource;
+            [operation start];
+        }
+    }];
+
+    [self benchmarkWithName:@"RKMapperOperation collection" objectCount:[representations count] executionBlock:^{
+        RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"users": representations } mappingsDictionary:@{ @"users": nestedMapping }];
+        [mapper execute:nil];
+    }];
+}
+
+- (void)benchmarkParameterizationAndPathMatchingWithRepresentations:(NSArray *)representations
+{
+    RKObjectMapping *userMapping = [self userMapping];
+    NSMutableArray *users = [NSMutableArray arrayWithCapacity:[representations count]];
+    for (NSDictionary *representation in representations) {
+        RKTestUser *user = [RKTestUser new];
+        user.userID = [representation objectForKey:@"id"];
+        user.name = [representation objectForKey:@"name"];
+        user.emailAddress = [representation objectForKey:@"email"];
+        [users addObject:user];
+    }
+
+    RKRequestDescriptor *requestDescriptor = [RKRequestDescriptor requestDescriptorWithMapping:[userMapping inverseMapping] objectClass:[RKTestUser class] rootKeyPath:@"user" method:RKRequestMethodAny];
+    [self benchmarkWithName:@"RKObjectParameterization" objectCount:[users count] executionBlock:^{
+        for (RKTestUser *user in users) {
+            [RKObjectParameterization parametersWithObject:user requestDescriptor:requestDescriptor error:nil];
+        }
+    }];
+
+    NSMutableArray *paths = [NSMutableArray arrayWithCapacity:[users count]];
+    for (RKTestUser *user in users) {
+        [paths addObject:[NSString stringWithFormat:@"/users/%@/addresses/%@?include=friends", user.userID, user.userID]];
+    }
+    RKPathMatcher *pathMatcher = [RKPathMatcher pathMatcherWithPattern:@"/users/:userID/addresses/:addressID"];
+    [self benchmarkWithName:@"RKPathMatcher" objectCount:[paths count] executionBlock:^{
+        for (NSString *path in paths) {
+            NSDictionary *arguments = nil;
+            [pathMatcher matchesPath:path tokenizeQueryStrings:YES parsedArguments:&arguments];
+        }
+    }];
+}
+
+- (void)benchmarkEntityByAttributeCacheWithObjectCount:(NSUInteger)objectCount
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    NSMutableSet *humans = [NSMutableSet setWithCapacity:objectCount];
+    for (NSUInteger i = 0; i < objectCount; i++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        human.railsID = @(i);
+        human.name = [NSString stringWithFormat:@"Human %lu", (unsigned long)i];
+        [humans addObject:human];
+    }
+    [managedObjectContext save:nil];
+
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    RKEntityByAttributeCache *cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:@[ @"railsID" ] managedObjectContext:managedObjectContext];
+    __block BOOL loaded = NO;
+    [cache load:^{
+        loaded = YES;
+    }];
+    RKBenchmarkWaitUntil(@"the cache to load", ^BOOL{ return loaded; });
+
+    [self benchmarkWithName:@"RKEntityByAttributeCache lookup" objectCount:objectCount executionBlock:^{
+        for (NSUInteger i = 0; i < objectCount; i++) {
+            [cache objectWithAttributeValues:@{ @"railsID": @(i) } inContext:managedObjectContext];
+        }
+    }];
+
+    // Bounding the cache at its size records CLOCK references on every hit without evicting anything, so that the single threaded and concurrent runs can be compared for scaling
+    cache.maximumObjectIDCount = objectCount;
+    NSUInteger processorCount = [[NSProcessInfo processInfo] activeProcessorCount];
+    for (NSNumber *workerCountNumber in [[NSOrderedSet orderedSetWithArray:@[ @1, @(processorCount) ]] array]) {
+        NSUInteger workerCount = [workerCountNumber unsignedIntegerValue];
+        [self benchmarkWithName:[NSString stringWithFormat:@"RKEntityByAttributeCache concurrent lookup (%lu threads)", (unsigned long)workerCount] objectCount:objectCount executionBlock:^{
+            dispatch_apply(workerCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t worker) {
+                for (NSUInteger i = worker; i < objectCount; i += workerCount) {
+                    [cache objectIDsWithAttributeValues:@{ @"railsID": @(i) }];
+                }
+            });
+        }];
+    }
+
+    RKEntityByAttributeCache *compoundCache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:@[ @"railsID", @"name" ] managedObjectContext:managedObjectContext];
+    [self benchmarkWithName:@"RKEntityByAttributeCache insert" objectCount:objectCount executionBlock:^{
+        __block BOOL added = NO;
+        [compoundCache addObjects:humans completion:^{
+            added = YES;
+        }];
+        RKBenchmarkWaitUntil(@"the objects to be added to the cache", ^BOOL{ return added; });
+    }];
+    [self benchmarkWithName:@"RKEntityByAttributeCache compound lookup" objectCount:objectCount executionBlock:^{
+        for (NSUInteger i = 0; i < objectCount; i++) {
+            [compoundCache objectWithAttributeValues:@{ @"railsID": @(i), @"name": [NSString stringWithFormat:@"Human %lu", (unsigned long)i] } inContext:managedObjectContext];
+        }
+    }];
+    [RKTestFactory tearDown];
+    [RKTestFactory setUp];
+}
+
+- (void)benchmarkSearchIndexerWithObjectCount:(NSUInteger)objectCount
+{
+    NSManagedObjectModel *managedObjectModel = RKBenchmarkManagedObjectModel();
+    NSEntityDescription *entity = [[managedObjectModel entitiesByName] objectForKey:@"Human"];
+    [RKSearchIndexer addSearchIndexingToEntity:entity onAttributes:@[ @"name", @"nickName" ]];
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [[NSPersistentStoreCoordinator alloc] initWithManagedObjectModel:managedObjectModel];
+    [persistentStoreCoordinator addPersistentStoreWithType:NSInMemoryStoreType configuration:nil URL:nil options:nil error:nil];
+    NSManagedObjectContext *managedObjectContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    managedObjectContext.persistentStoreCoordinator = persistentStoreCoordinator;
+
+    NSMutableArray *humans = [NSMutableArray arrayWithCapacity:objectCount];
+    for (NSUInteger i = 0; i < objectCount; i++) {
+        NSManagedObject *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+        [human setValue:[NSString stringWithFormat:@"Human number %lu of the benchmark", (unsigned long)(i % 100)] forKey:@"name"];
+        [human setValue:[NSString stringWithFormat:@"nick%lu", (unsigned long)(i % 100)] forKey:@"nickName"];
+        [humans addObject:human];
+    }
+
+    RKSearchIndexer *indexer = [RKSearchIndexer new];
+    [self benchmarkWithName:@"RKSearchIndexer" objectCount:objectCount executionBlock:^{
+        for (NSManagedObject *human in humans) {
+            [indexer indexManagedObject:human];
+        }
+    }];
+}
+
+@end